@@ -5,6 +5,7 @@
 #include "Collision.h"
 #include "Contracts.h"
 #include "PieceBase.h"
+#include "Symbol.h"
 #include "Player.h"
 #include "Vector2.h"
 
@@ -12,7 +13,7 @@ using namespace Arcade;
 
 /// \brief Creates a new actor instance.
 /// \post ensure(this->CheckInvariants());
-Actor::Actor(std::string Name)
+Actor::Actor(Symbol Name)
 {
     this->SetName(Name);
     ensure(this->CheckInvariants());
@@ -20,17 +21,17 @@ Actor::Actor(std::string Name)
 
 /// \brief Attacks this piece. A boolean is returned which indicates
 /// whether it has been destroyed or not.
-/// \pre require(Event.GetStaticPiece().get() == this);
+/// \pre require(Event.GetStaticPiece() == this);
 /// \pre require(this->CheckInvariants());
 /// \post ensure(result);
-/// \post ensure(this->CheckInvariants());
 bool Actor::Attack(Collision Event)
 {
-    require(Event.GetStaticPiece().get() == this);
+    require(Event.GetStaticPiece() == this);
     require(this->CheckInvariants());
-    bool result = Event.GetScene()->RemovePiece(Event.GetStaticPiece());
+    // Removing this actor may destroy it, so its invariants can no
+    // longer be checked afterwards.
+    bool result = Event.GetScene()->RemovePiece(Event.GetStaticHandle());
     ensure(result);
-    ensure(this->CheckInvariants());
     return result;
 }
 
@@ -38,26 +39,22 @@ bool Actor::Attack(Collision Event)
 /// A boolean value is returned that indicates whether this is
 /// indeed the case. This method is publically visible, and can
 /// be used to verify an instance's state.
+/// \remark Pieces may be shared by boards that other threads are
+/// reading, so this method must not write to the piece.
 bool Actor::CheckInvariants() const
 {
-    if (!this->isCheckingInvariants)
-    {
-        this->isCheckingInvariants = true;
-        bool result = this->CheckInvariantsCore();
-        this->isCheckingInvariants = false;
-        return result;
-    }
-    return true;
+    return this->CheckInvariantsCore();
 }
 
 /// \brief Checks if this type's invariants are being respected.
 /// A boolean value is returned that indicates whether this is
 /// indeed the case.
 /// \remark This method should not be called directly.
-/// It should only be called from 'CheckInvariants'.
+/// It should only be called from 'CheckInvariants'. It reads fields
+/// directly, because accessors check the invariants again.
 bool Actor::CheckInvariantsCore() const
 {
-    return this->GetName() != "";
+    return !this->Name_value.GetText().empty();
 }
 
 /// \brief Moves the piece to the given target position.
@@ -92,14 +89,14 @@ bool Actor::GetMovable() const
 
 /// \brief Gets the actor's name.
 /// \pre require(this->CheckInvariants());
-std::string Actor::GetName() const
+Symbol Actor::GetName() const
 {
     require(this->CheckInvariants());
     return this->Name_value;
 }
 
 /// \brief Sets the actor's name.
-void Actor::SetName(std::string value)
+void Actor::SetName(Symbol value)
 {
     this->Name_value = value;
 }
\ No newline at end of file
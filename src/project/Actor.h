@@ -2,6 +2,7 @@
 #include <string>
 #include "Contracts.h"
 #include "PieceBase.h"
+#include "Symbol.h"
 #include "Vector2.h"
 
 namespace Arcade
@@ -16,25 +17,26 @@ namespace Arcade
     public:
         /// \brief Creates a new actor instance.
         /// \post ensure(this->CheckInvariants());
-        Actor(std::string Name);
+        Actor(Symbol Name);
 
         /// \brief Attacks this piece. A boolean is returned which indicates
         /// whether it has been destroyed or not.
-        /// \pre require(Event.GetStaticPiece().get() == this);
+        /// \pre require(Event.GetStaticPiece() == this);
         /// \pre require(this->CheckInvariants());
         /// \post ensure(result);
-        /// \post ensure(this->CheckInvariants());
         bool Attack(Collision Event) override;
 
         /// \brief Checks if this type's invariants are being respected.
         /// A boolean value is returned that indicates whether this is
         /// indeed the case. This method is publically visible, and can
         /// be used to verify an instance's state.
+        /// \remark Pieces may be shared by boards that other threads are
+        /// reading, so this method must not write to the piece.
         bool CheckInvariants() const;
 
         /// \brief Gets the actor's name.
         /// \pre require(this->CheckInvariants());
-        std::string GetName() const;
+        Symbol GetName() const;
 
         /// \brief Moves the piece to the given target position.
         /// \pre require(this->CheckInvariants());
@@ -56,16 +58,16 @@ namespace Arcade
         /// A boolean value is returned that indicates whether this is
         /// indeed the case.
         /// \remark This method should not be called directly.
-        /// It should only be called from 'CheckInvariants'.
+        /// It should only be called from 'CheckInvariants'. It reads fields
+        /// directly, because accessors check the invariants again.
         virtual bool CheckInvariantsCore() const;
         // {
-        //     return this->GetName() != "";
+        //     return !this->Name_value.GetText().empty();
         // }
     private:
         /// \brief Sets the actor's name.
-        void SetName(std::string value);
+        void SetName(Symbol value);
 
-        mutable bool isCheckingInvariants = false;
-        std::string Name_value;
+        Symbol Name_value;
     };
 }
\ No newline at end of file
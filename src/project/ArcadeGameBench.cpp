@@ -0,0 +1,402 @@
+// Microbenchmarks for the arcade game's hot paths.
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "ASCIIArtUIHandler.h"
+#include "ArraySlice.h"
+#include "Board.h"
+#include "CommandStream.h"
+#include "Goal.h"
+#include "MoveCommand.h"
+#include "Obstacle.h"
+#include "ParseXML.h"
+#include "PieceArena.h"
+#include "Player.h"
+
+using namespace Arcade;
+
+// Every allocation made through the global operator new is counted,
+// so that benchmarks can report allocations per operation.
+static long long allocationCount = 0;
+
+void* operator new(std::size_t Size)
+{
+	allocationCount++;
+	void* result = std::malloc(Size == 0 ? 1 : Size);
+	if (result == nullptr)
+		throw std::bad_alloc();
+	return result;
+}
+
+void* operator new[](std::size_t Size)
+{
+	return operator new(Size);
+}
+
+void operator delete(void* Pointer) noexcept
+{
+	std::free(Pointer);
+}
+
+void operator delete[](void* Pointer) noexcept
+{
+	std::free(Pointer);
+}
+
+void operator delete(void* Pointer, std::size_t) noexcept
+{
+	std::free(Pointer);
+}
+
+void operator delete[](void* Pointer, std::size_t) noexcept
+{
+	std::free(Pointer);
+}
+
+/// \brief Describes the outcome of a single benchmark.
+struct BenchResult
+{
+	std::string Name;
+	long long Iterations;
+	double NanosecondsPerIteration;
+	double AllocationsPerIteration;
+};
+
+void PrintResult(const BenchResult& Result)
+{
+	std::cout << Result.Name << ": "
+		<< Result.Iterations << " iterations, "
+		<< Result.NanosecondsPerIteration << " ns/iteration, "
+		<< Result.AllocationsPerIteration << " allocations/iteration" << std::endl;
+}
+
+/// \brief Sets up a corridor in which a player can walk back and forth
+/// between two walls, across a goal, and returns the player.
+std::shared_ptr<Player> CreateCorridor(std::shared_ptr<Board>& Scene)
+{
+	Scene = std::make_shared<Board>("Bench", Vector2<int>(16, 16));
+	auto player = std::make_shared<Player>(Vector2<int>(1, 1), "Speler");
+	Scene->AddPiece(std::make_shared<Obstacle>(Vector2<int>(0, 1), "muur", false));
+	Scene->AddPiece(std::make_shared<Obstacle>(Vector2<int>(3, 1), "muur", false));
+	Scene->AddPiece(std::make_shared<Goal>(Vector2<int>(2, 1)));
+	Scene->AddPiece(player);
+	return player;
+}
+
+/// \brief Has a player walk back and forth between two walls, across
+/// a goal, and measures the cost of each MoveCommand::Execute call.
+/// Half of the moves bump into a wall, the other half succeed.
+BenchResult BenchMoveCommand(long long Iterations)
+{
+	std::shared_ptr<Board> brd;
+	auto player = CreateCorridor(brd);
+	for (int i = 0; i < 64; i++)
+		brd->AddPiece(std::make_shared<Obstacle>(Vector2<int>(i % 16, 4 + i / 16), "ton", true));
+
+	// Left (bump), right, right (bump), left.
+	std::vector<std::shared_ptr<MoveCommand>> cycle;
+	cycle.push_back(std::make_shared<MoveCommand>(player, Vector2<int>(-1, 0)));
+	cycle.push_back(std::make_shared<MoveCommand>(player, Vector2<int>(1, 0)));
+	cycle.push_back(std::make_shared<MoveCommand>(player, Vector2<int>(1, 0)));
+	cycle.push_back(std::make_shared<MoveCommand>(player, Vector2<int>(-1, 0)));
+
+	long long startAllocations = allocationCount;
+	auto start = std::chrono::steady_clock::now();
+	for (long long i = 0; i < Iterations; i++)
+		cycle[i % cycle.size()]->Execute(brd);
+	auto end = std::chrono::steady_clock::now();
+	long long allocations = allocationCount - startAllocations;
+
+	BenchResult result;
+	result.Name = "MoveCommand::Execute";
+	result.Iterations = Iterations;
+	result.NanosecondsPerIteration = std::chrono::duration<double, std::nano>(end - start).count() / Iterations;
+	result.AllocationsPerIteration = (double)allocations / Iterations;
+	return result;
+}
+
+/// \brief Records a long action sequence, as parseMoves and
+/// parseCommandStream would, and replays it on the corridor board.
+/// The cost of recording and replaying is reported per action.
+template<typename TRecord, typename TReplay>
+BenchResult BenchReplay(std::string Name, long long Actions, TRecord Record, TReplay Replay)
+{
+	std::shared_ptr<Board> brd;
+	auto player = CreateCorridor(brd);
+	const int offsets[] = { -1, 1, 1, -1 };
+
+	long long startAllocations = allocationCount;
+	auto start = std::chrono::steady_clock::now();
+	auto actions = Record(player, offsets, Actions);
+	Replay(actions, brd);
+	auto end = std::chrono::steady_clock::now();
+	long long allocations = allocationCount - startAllocations;
+
+	BenchResult result;
+	result.Name = Name;
+	result.Iterations = Actions;
+	result.NanosecondsPerIteration = std::chrono::duration<double, std::nano>(end - start).count() / Actions;
+	result.AllocationsPerIteration = (double)allocations / Actions;
+	return result;
+}
+
+/// \brief Compares recording and replaying action sequences as command
+/// objects and as a packed command stream.
+void BenchReplays(long long Actions)
+{
+	PrintResult(BenchReplay("Replay (ICommand)", Actions, [](std::shared_ptr<Player> Actor, const int* Offsets, long long Count)
+	{
+		std::vector<std::shared_ptr<ICommand<std::shared_ptr<Board>>>> actions;
+		for (long long i = 0; i < Count; i++)
+			actions.push_back(std::make_shared<MoveCommand>(Actor, Vector2<int>(Offsets[i % 4], 0)));
+		return actions;
+	}, [](const std::vector<std::shared_ptr<ICommand<std::shared_ptr<Board>>>>& Actions, std::shared_ptr<Board> Scene)
+	{
+		for (auto& item : Actions)
+			item->Execute(Scene);
+	}));
+	PrintResult(BenchReplay("Replay (CommandStream)", Actions, [](std::shared_ptr<Player> Actor, const int* Offsets, long long Count)
+	{
+		CommandStream actions;
+		for (long long i = 0; i < Count; i++)
+			actions.Append(ActionKind::Move, Actor, Vector2<int>(Offsets[i % 4], 0));
+		return actions;
+	}, [](const CommandStream& Actions, std::shared_ptr<Board> Scene)
+	{
+		Actions.ExecuteAll(*Scene);
+	}));
+}
+
+/// \brief Sums the elements of the given sequence Iterations times over,
+/// using the given traversal, and measures the cost per element.
+template<typename TSequence, typename TSum>
+BenchResult BenchTraversal(std::string Name, const TSequence& Values, int Length, long long Iterations, TSum Sum)
+{
+	long long total = 0;
+	long long startAllocations = allocationCount;
+	auto start = std::chrono::steady_clock::now();
+	for (long long i = 0; i < Iterations; i++)
+	{
+		total += Sum(Values);
+		// Keep the compiler from merging consecutive passes.
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+	}
+	auto end = std::chrono::steady_clock::now();
+	long long allocations = allocationCount - startAllocations;
+
+	// Print the sum, so that the traversal cannot be optimized away.
+	std::cout << "(" << total << ") ";
+
+	BenchResult result;
+	result.Name = Name;
+	result.Iterations = Iterations * Length;
+	result.NanosecondsPerIteration = std::chrono::duration<double, std::nano>(end - start).count() / result.Iterations;
+	result.AllocationsPerIteration = (double)allocations / result.Iterations;
+	return result;
+}
+
+/// \brief Compares iterating over and indexing into an ArraySlice with
+/// doing the same for an std::vector.
+void BenchArraySlice(long long Iterations)
+{
+	const int length = 4096;
+	std::vector<int> vector(length);
+	for (int i = 0; i < length; i++)
+		vector[i] = i;
+	stdx::ArraySlice<int> slice(vector);
+	long long passes = Iterations / length > 0 ? Iterations / length : 1;
+
+	PrintResult(BenchTraversal("std::vector (range-for)", vector, length, passes, [](const std::vector<int>& Values)
+	{
+		long long sum = 0;
+		for (auto item : Values)
+			sum += item;
+		return sum;
+	}));
+	PrintResult(BenchTraversal("ArraySlice (range-for)", slice, length, passes, [](const stdx::ArraySlice<int>& Values)
+	{
+		long long sum = 0;
+		for (auto item : Values)
+			sum += item;
+		return sum;
+	}));
+	PrintResult(BenchTraversal("std::vector (operator[])", vector, length, passes, [](const std::vector<int>& Values)
+	{
+		long long sum = 0;
+		for (int i = 0; i < (int)Values.size(); i++)
+			sum += Values[i];
+		return sum;
+	}));
+	PrintResult(BenchTraversal("ArraySlice (operator[])", slice, length, passes, [](const stdx::ArraySlice<int>& Values)
+	{
+		long long sum = 0;
+		for (int i = 0; i < Values.GetLength(); i++)
+			sum += Values[i];
+		return sum;
+	}));
+}
+
+/// \brief Has a player walk back and forth across a large board, and
+/// measures the cost of applying each move and displaying the
+/// resulting ASCII art frame, as the slideshow does.
+BenchResult BenchSlideshow(long long Iterations)
+{
+	const int size = 256;
+	auto brd = std::make_shared<Board>("Bench", Vector2<int>(size, size));
+	auto player = std::make_shared<Player>(Vector2<int>(0, size / 2), "Speler");
+	brd->AddPiece(player);
+	for (int i = 0; i < size; i++)
+		brd->AddPiece(std::make_shared<Obstacle>(Vector2<int>(i, 0), "muur", false));
+
+	auto right = std::make_shared<MoveCommand>(player, Vector2<int>(1, 0));
+	auto left = std::make_shared<MoveCommand>(player, Vector2<int>(-1, 0));
+	std::ostringstream output;
+	ASCIIArtUIHandler handler(&output);
+	handler.Initialize(brd);
+
+	long long startAllocations = allocationCount;
+	auto start = std::chrono::steady_clock::now();
+	for (long long i = 0; i < Iterations; i++)
+	{
+		output.str("");
+		handler.Apply((i / (size - 1)) % 2 == 0 ? right : left);
+		handler.Display();
+	}
+	auto end = std::chrono::steady_clock::now();
+	long long allocations = allocationCount - startAllocations;
+
+	BenchResult result;
+	result.Name = "ASCIIArtUIHandler::Display (256x256)";
+	result.Iterations = Iterations;
+	result.NanosecondsPerIteration = std::chrono::duration<double, std::nano>(end - start).count() / Iterations;
+	result.AllocationsPerIteration = (double)allocations / Iterations;
+	return result;
+}
+
+/// \brief Measures the cost per piece of filling a square board with
+/// barrels that are created by the given function.
+template<typename TCreate>
+BenchResult BenchBuild(std::string Name, int Pieces, TCreate Create, std::shared_ptr<Board>& Result)
+{
+	int size = (int)std::ceil(std::sqrt((double)Pieces));
+	long long startAllocations = allocationCount;
+	auto start = std::chrono::steady_clock::now();
+	Result = std::make_shared<Board>("Bench", Vector2<int>(size, size));
+	for (int i = 0; i < Pieces; i++)
+		Result->AddPiece(Create(*Result, Vector2<int>(i % size, i / size)));
+	auto end = std::chrono::steady_clock::now();
+	long long allocations = allocationCount - startAllocations;
+
+	BenchResult result;
+	result.Name = Name;
+	result.Iterations = Pieces;
+	result.NanosecondsPerIteration = std::chrono::duration<double, std::nano>(end - start).count() / Pieces;
+	result.AllocationsPerIteration = (double)allocations / Pieces;
+	return result;
+}
+
+/// \brief Measures the cost per cell of looking up every cell of the
+/// given board, and reading the piece in that cell.
+BenchResult BenchScan(std::string Name, const Board& Scene)
+{
+	long long startAllocations = allocationCount;
+	auto start = std::chrono::steady_clock::now();
+	int movable = 0;
+	for (int y = 0; y < Scene.GetHeight(); y++)
+		for (int x = 0; x < Scene.GetWidth(); x++)
+		{
+			auto item = Scene.GetItem(x, y);
+			if (item != nullptr && item->GetMovable())
+				movable++;
+		}
+	auto end = std::chrono::steady_clock::now();
+	long long allocations = allocationCount - startAllocations;
+
+	long long cells = (long long)Scene.GetWidth() * Scene.GetHeight();
+	BenchResult result;
+	result.Name = Name + " (" + std::to_string(movable) + " movable)";
+	result.Iterations = cells;
+	result.NanosecondsPerIteration = std::chrono::duration<double, std::nano>(end - start).count() / cells;
+	result.AllocationsPerIteration = (double)allocations / cells;
+	return result;
+}
+
+/// \brief Writes a square board with the given number of barrels to a
+/// temporary file, and measures the cost per piece of parsing it.
+BenchResult BenchParse(int Pieces, std::shared_ptr<Board>& Result)
+{
+	int size = (int)std::ceil(std::sqrt((double)Pieces));
+	std::string path = "ArcadeGameBench.tmp.xml";
+	{
+		std::ofstream file(path);
+		file << "<VELD><NAAM>Bench</NAAM><LENGTE>" << size << "</LENGTE><BREEDTE>" << size << "</BREEDTE>\n";
+		for (int i = 0; i < Pieces; i++)
+			file << "<TON beweegbaar=\"true\" x=\"" << i % size << "\" y=\"" << i / size << "\"/>\n";
+		file << "</VELD>\n";
+	}
+
+	long long startAllocations = allocationCount;
+	auto start = std::chrono::steady_clock::now();
+	Result = std::make_shared<Board>(parseBoard(path.c_str(), std::cerr));
+	auto end = std::chrono::steady_clock::now();
+	long long allocations = allocationCount - startAllocations;
+	std::remove(path.c_str());
+
+	BenchResult result;
+	result.Name = "parseBoard";
+	result.Iterations = Pieces;
+	result.NanosecondsPerIteration = std::chrono::duration<double, std::nano>(end - start).count() / Pieces;
+	result.AllocationsPerIteration = (double)allocations / Pieces;
+	return result;
+}
+
+/// \brief Compares boards whose pieces are allocated one by one to
+/// boards whose pieces are allocated in the board's arena.
+void BenchPieceAllocation(int Pieces)
+{
+	std::shared_ptr<Board> brd;
+	PrintResult(BenchBuild("AddPiece (make_shared)", Pieces, [](Board& Scene, Vector2<int> Position)
+	{
+		return std::make_shared<Obstacle>(Position, "ton", true);
+	}, brd));
+	PrintResult(BenchScan("GetItem (make_shared)", *brd));
+	brd = nullptr;
+
+	PrintResult(BenchBuild("AddPiece (arena)", Pieces, [](Board& Scene, Vector2<int> Position)
+	{
+		return Scene.GetArena()->Create<Obstacle>(Position, "ton", true);
+	}, brd));
+	PrintResult(BenchScan("GetItem (arena)", *brd));
+	brd = nullptr;
+
+	PrintResult(BenchParse(Pieces, brd));
+	PrintResult(BenchScan("GetItem (parsed)", *brd));
+}
+
+int main(int argc, char** argv)
+{
+	long long iterations = argc > 1 ? std::atoll(argv[1]) : 1000000;
+	int pieces = argc > 2 ? std::atoi(argv[2]) : 1000000;
+	if (iterations <= 0 || pieces <= 0)
+	{
+		std::cerr << "Het aantal iteraties en stukken moet strikt positief zijn." << std::endl;
+		return 1;
+	}
+
+	PrintResult(BenchMoveCommand(iterations));
+	BenchReplays(iterations);
+	BenchArraySlice(iterations * 100);
+	PrintResult(BenchSlideshow(iterations / 1000 > 0 ? iterations / 1000 : 1));
+	BenchPieceAllocation(pieces);
+	return 0;
+}
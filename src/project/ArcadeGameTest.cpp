@@ -1,14 +1,45 @@
 // Tests for version 1.0 of the specification.
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <numeric>
 #include <fstream>
+#include <iomanip>
 #include <sstream>
+#include <vector>
 #include "gtest/gtest.h"
+#include "ASCIIArtUIHandler.h"
+#include "ArraySlice.h"
+#include "BatchRunner.h"
 #include "Board.h"
+#include "BoardJournal.h"
+#include "Button.h"
+#include "CheckpointedReplay.h"
+#include "Collision.h"
+#include "CommandStream.h"
+#include "Contracts.h"
+#include "DeadCellAnalysis.h"
+#include "DirtyCellTracker.h"
+#include "Gate.h"
+#include "Goal.h"
+#include "IBoardObserver.h"
 #include "Obstacle.h"
 #include "MoveCommand.h"
 #include "ParseXML.h"
+#include "PieceArena.h"
+#include "PieceHandle.h"
+#include "SaveCommand.h"
+#include "Solver.h"
+#include "Symbol.h"
 #include "TestHelpers.h"
+#include "TranspositionTable.h"
+#include "Water.h"
+#include "WorkStealingPool.h"
 
 using namespace Arcade;
 
@@ -111,6 +142,892 @@ TEST(HappyDay, RemovePlayer)
 	EXPECT_EQ(brd->GetPieces().size(), 2);
 }
 
+TEST(HappyDay, ItemIndex)
+{
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(5, 5));
+	auto goal = std::make_shared<Goal>(Vector2<int>(0, 2));
+	auto flanders = std::make_shared<Player>(Vector2<int>(0, 0), PlayerName);
+	auto barrel = std::make_shared<Obstacle>(Vector2<int>(0, 1), "ton", true);
+
+	brd->AddPiece(goal);
+	brd->AddPiece(flanders);
+	brd->AddPiece(barrel);
+
+	MoveCommand movement(flanders, { 0, 1 });
+	EXPECT_TRUE(movement.Execute(brd));
+	EXPECT_EQ(brd->GetItem(0, 0), nullptr);
+	EXPECT_EQ(brd->GetItem(0, 1), flanders);
+	EXPECT_EQ(brd->GetItem(0, 2), barrel); // Occupants take precedence over terrain.
+
+	EXPECT_TRUE(brd->RemovePiece(barrel));
+	EXPECT_EQ(brd->GetItem(0, 2), goal);
+}
+
+TEST(HappyDay, DuplicateActorNames)
+{
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(5, 5));
+	auto first = std::make_shared<Player>(Vector2<int>(0, 0), PlayerName);
+	auto second = std::make_shared<Player>(Vector2<int>(1, 0), PlayerName);
+
+	brd->AddPiece(first);
+	brd->AddPiece(second);
+	EXPECT_EQ(brd->GetActor(PlayerName), first);
+
+	EXPECT_TRUE(brd->RemovePiece(first));
+	EXPECT_EQ(brd->GetActor(PlayerName), second);
+
+	EXPECT_TRUE(brd->RemovePiece(second));
+	EXPECT_FALSE(brd->HasActor(PlayerName));
+}
+
+TEST(HappyDay, TypedRegistries)
+{
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(5, 5));
+	auto flanders = std::make_shared<Player>(Vector2<int>(0, 0), PlayerName);
+	auto wall = std::make_shared<Obstacle>(Vector2<int>(1, 1), ObstacleName, false);
+	auto goal = std::make_shared<Goal>(Vector2<int>(2, 2));
+
+	brd->AddPiece(flanders);
+	brd->AddPiece(wall);
+	brd->AddPiece(goal);
+	EXPECT_EQ(brd->GetPlayers().size(), 1);
+	EXPECT_EQ(brd->GetObstacles().size(), 1);
+	EXPECT_EQ(brd->GetGoals().size(), 1);
+	EXPECT_TRUE(brd->GetGates().empty());
+
+	EXPECT_TRUE(brd->RemovePiece(wall));
+	EXPECT_TRUE(brd->GetObstacles().empty());
+	EXPECT_EQ(brd->GetGoals().front(), goal);
+}
+
+TEST(HappyDay, RemovalKeepsOrder)
+{
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(8, 8));
+	std::vector<std::shared_ptr<Obstacle>> walls;
+	for (int i = 0; i < 8; i++)
+	{
+		walls.push_back(std::make_shared<Obstacle>(Vector2<int>(i, 0), ObstacleName, false));
+		brd->AddPiece(walls.back());
+	}
+
+	for (int i = 0; i < 8; i += 2)
+		EXPECT_TRUE(brd->RemovePiece(walls[i]));
+	EXPECT_FALSE(brd->RemovePiece(walls[0]));
+
+	std::vector<std::shared_ptr<PieceBase>> pieces = brd->GetPieces();
+	ASSERT_EQ(pieces.size(), 4);
+	for (int i = 0; i < 4; i++)
+		EXPECT_EQ(pieces[i], walls[2 * i + 1]);
+	EXPECT_EQ(brd->GetObstacles().size(), 4);
+	EXPECT_EQ(brd->GetItem(1, 0), walls[1]);
+	EXPECT_EQ(brd->GetItem(2, 0), nullptr);
+}
+
+TEST(HappyDay, StateHash)
+{
+	auto first = std::make_shared<Board>(BoardName, Vector2<int>(5, 5));
+	auto second = std::make_shared<Board>(BoardName, Vector2<int>(5, 5));
+	auto flanders = std::make_shared<Player>(Vector2<int>(0, 0), PlayerName);
+	auto wall = std::make_shared<Obstacle>(Vector2<int>(1, 1), ObstacleName, false);
+	auto barrel = std::make_shared<Obstacle>(Vector2<int>(2, 2), ObstacleName, true);
+	auto empty = first->GetStateHash();
+
+	first->AddPiece(flanders);
+	first->AddPiece(wall);
+	first->AddPiece(barrel);
+	second->AddPiece(std::make_shared<Obstacle>(Vector2<int>(2, 2), ObstacleName, true));
+	second->AddPiece(std::make_shared<Obstacle>(Vector2<int>(1, 1), ObstacleName, false));
+	second->AddPiece(std::make_shared<Player>(Vector2<int>(0, 0), PlayerName));
+	EXPECT_EQ(first->GetStateHash(), second->GetStateHash());
+
+	auto hash = first->GetStateHash();
+	MoveCommand(flanders, Vector2<int>(1, 0)).Execute(first);
+	EXPECT_NE(first->GetStateHash(), hash);
+	MoveCommand(flanders, Vector2<int>(-1, 0)).Execute(first);
+	EXPECT_EQ(first->GetStateHash(), hash);
+
+	first->RemovePiece(flanders);
+	first->RemovePiece(wall);
+	first->RemovePiece(barrel);
+	EXPECT_EQ(first->GetStateHash(), empty);
+}
+
+TEST(HappyDay, Fork)
+{
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(5, 5));
+	auto flanders = std::make_shared<Player>(Vector2<int>(0, 0), PlayerName);
+	auto barrel = std::make_shared<Obstacle>(Vector2<int>(1, 0), ObstacleName, true);
+	brd->AddPiece(flanders);
+	brd->AddPiece(barrel);
+
+	auto fork = brd->Fork();
+	EXPECT_EQ(fork->GetStateHash(), brd->GetStateHash());
+	EXPECT_TRUE(MoveCommand(flanders, Vector2<int>(1, 0)).Execute(fork));
+	EXPECT_NE(fork->GetStateHash(), brd->GetStateHash());
+
+	// The original board is left untouched.
+	EXPECT_EQ(flanders->GetPosition(), Vector2<int>(0, 0));
+	EXPECT_EQ(brd->GetItem(0, 0), flanders);
+	EXPECT_EQ(brd->GetItem(1, 0), barrel);
+	EXPECT_EQ(brd->GetItem(2, 0), nullptr);
+
+	// The fork has its own copies of the pieces that were moved.
+	auto forkedPlayer = fork->GetActor(PlayerName);
+	EXPECT_NE(forkedPlayer, flanders);
+	EXPECT_EQ(forkedPlayer->GetId(), flanders->GetId());
+	EXPECT_EQ(forkedPlayer->GetPosition(), Vector2<int>(1, 0));
+	EXPECT_EQ(fork->ResolvePiece(barrel)->GetPosition(), Vector2<int>(2, 0));
+	EXPECT_EQ(fork->GetItem(0, 0), nullptr);
+	EXPECT_EQ(fork->GetPlayers().front(), forkedPlayer);
+
+	EXPECT_TRUE(fork->RemovePiece(flanders));
+	EXPECT_FALSE(fork->HasActor(PlayerName));
+	EXPECT_TRUE(brd->HasActor(PlayerName));
+	EXPECT_TRUE(brd->HasPiece(flanders));
+}
+
+TEST(HappyDay, PressedButtons)
+{
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(5, 5));
+	auto flanders = std::make_shared<Player>(Vector2<int>(0, 0), PlayerName);
+	auto first = std::make_shared<Button>(Vector2<int>(1, 0));
+	auto second = std::make_shared<Button>(Vector2<int>(2, 0));
+	auto gate = std::make_shared<Gate>(Vector2<int>(4, 4), "poort", stdx::ArraySlice<std::shared_ptr<Button>>({ first, second }));
+	brd->AddPiece(first);
+	brd->AddPiece(second);
+	brd->AddPiece(std::make_shared<Obstacle>(Vector2<int>(2, 0), ObstacleName, true));
+	brd->AddPiece(gate);
+	brd->AddPiece(flanders);
+	EXPECT_EQ(brd->GetPressedButtonCount(*gate), 1);
+	EXPECT_TRUE(gate->IsOpened(brd));
+
+	EXPECT_TRUE(MoveCommand(flanders, Vector2<int>(1, 0)).Execute(brd));
+	EXPECT_EQ(brd->GetPressedButtonCount(*gate), 2);
+
+	// Pushing the barrel off its button leaves one button pressed.
+	EXPECT_TRUE(MoveCommand(flanders, Vector2<int>(1, 0)).Execute(brd));
+	EXPECT_EQ(brd->GetPressedButtonCount(*gate), 1);
+	EXPECT_TRUE(MoveCommand(flanders, Vector2<int>(0, 1)).Execute(brd));
+	EXPECT_EQ(brd->GetPressedButtonCount(*gate), 0);
+	EXPECT_FALSE(gate->IsOpened(brd));
+
+	EXPECT_TRUE(brd->RemovePiece(gate));
+	EXPECT_EQ(brd->GetPressedButtonCount(*gate), -1);
+}
+
+TEST(HappyDay, AssociatedGates)
+{
+	auto first = std::make_shared<Button>(Vector2<int>(1, 0));
+	auto second = std::make_shared<Button>(Vector2<int>(2, 0));
+	auto loose = std::make_shared<Button>(Vector2<int>(3, 0));
+	auto gate = std::make_shared<Gate>(Vector2<int>(4, 4), "poort", stdx::ArraySlice<std::shared_ptr<Button>>({ first, second }));
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(5, 5), std::vector<std::shared_ptr<PieceBase>>({ gate, first, second, loose }));
+
+	EXPECT_EQ(first->GetAssociatedGate(brd), gate);
+	EXPECT_EQ(second->GetAssociatedGateName(brd), "poort");
+	EXPECT_EQ(loose->GetAssociatedGate(brd), nullptr);
+
+	EXPECT_TRUE(brd->RemovePiece(gate));
+	EXPECT_EQ(first->GetAssociatedGate(brd), nullptr);
+	EXPECT_EQ(second->GetAssociatedGateName(brd), "");
+}
+
+/// \brief A board observer that writes every event it receives to a
+/// string stream.
+struct RecordingObserver : public IBoardObserver
+{
+	void PieceAdded(const Board& /*Scene*/, const std::shared_ptr<PieceBase>& Piece) override
+	{
+		this->Log << "added " << Piece->GetPosition().X << "," << Piece->GetPosition().Y << ";";
+	}
+
+	void PieceRemoved(const Board& /*Scene*/, const std::shared_ptr<PieceBase>& Piece) override
+	{
+		this->Log << "removed " << Piece->GetPosition().X << "," << Piece->GetPosition().Y << ";";
+	}
+
+	void PieceMoved(const Board& /*Scene*/, const std::shared_ptr<PieceBase>& /*Piece*/, Vector2<int> Source, Vector2<int> Target) override
+	{
+		this->Log << "moved " << Source.X << "," << Source.Y << " " << Target.X << "," << Target.Y << ";";
+	}
+
+	void GateToggled(const Board& /*Scene*/, const std::shared_ptr<Gate>& /*Piece*/, bool IsOpened) override
+	{
+		this->Log << (IsOpened ? "opened;" : "closed;");
+	}
+
+	std::ostringstream Log;
+};
+
+TEST(HappyDay, ChangeEvents)
+{
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(5, 5));
+	auto flanders = std::make_shared<Player>(Vector2<int>(0, 0), PlayerName);
+	auto button = std::make_shared<Button>(Vector2<int>(1, 0));
+	auto gate = std::make_shared<Gate>(Vector2<int>(4, 4), "poort", stdx::ArraySlice<std::shared_ptr<Button>>({ button }));
+	brd->AddPiece(button);
+	brd->AddPiece(gate);
+
+	RecordingObserver observer;
+	brd->Subscribe(&observer);
+	brd->AddPiece(flanders);
+	EXPECT_TRUE(MoveCommand(flanders, Vector2<int>(1, 0)).Execute(brd));
+	EXPECT_TRUE(MoveCommand(flanders, Vector2<int>(0, 1)).Execute(brd));
+
+	// Forks do not inherit their parent's observers.
+	auto fork = brd->Fork();
+	EXPECT_TRUE(fork->RemovePiece(flanders));
+
+	EXPECT_TRUE(brd->RemovePiece(flanders));
+	EXPECT_TRUE(brd->Unsubscribe(&observer));
+	EXPECT_FALSE(brd->Unsubscribe(&observer));
+	brd->AddPiece(flanders);
+	EXPECT_EQ(observer.Log.str(), "added 0,0;moved 0,0 1,0;opened;moved 1,0 1,1;closed;removed 1,1;");
+}
+
+TEST(HappyDay, IncrementalFrames)
+{
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(6, 4));
+	auto flanders = std::make_shared<Player>(Vector2<int>(0, 0), PlayerName);
+	auto button = std::make_shared<Button>(Vector2<int>(2, 0));
+	auto gate = std::make_shared<Gate>(Vector2<int>(5, 3), "poort", stdx::ArraySlice<std::shared_ptr<Button>>({ button }));
+	brd->AddPiece(button);
+	brd->AddPiece(gate);
+	brd->AddPiece(flanders);
+	brd->AddPiece(std::make_shared<Obstacle>(Vector2<int>(1, 0), "ton", true));
+
+	std::ostringstream frames;
+	ASCIIArtUIHandler handler(&frames);
+	handler.Initialize(brd);
+	DirtyCellTracker tracker(brd);
+	Vector2<int> offsets[] = { { 1, 0 }, { 1, 0 }, { 0, 1 }, { 1, 0 }, { 0, -1 } };
+	for (auto& offset : offsets)
+	{
+		handler.Apply(std::make_shared<MoveCommand>(flanders, offset));
+		frames.str("");
+		handler.Display();
+
+		// Every frame must match a frame that was rendered from scratch.
+		std::ostringstream expected;
+		ASCIIArtUIHandler(&expected).Initialize(brd);
+		EXPECT_EQ(frames.str(), expected.str());
+	}
+
+	// The player pushed the barrel across the button, which opened
+	// and closed the gate, and then walked around the barrel.
+	EXPECT_EQ(tracker.GetDirtyCells().size(), 7);
+	tracker.Clear();
+	EXPECT_TRUE(tracker.GetDirtyCells().empty());
+}
+
+TEST(HappyDay, PieceHandles)
+{
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(5, 5));
+	auto flanders = std::make_shared<Player>(Vector2<int>(0, 0), PlayerName);
+	auto barrel = std::make_shared<Obstacle>(Vector2<int>(1, 0), ObstacleName, true);
+	auto pond = std::make_shared<Water>(Vector2<int>(2, 0), false);
+	brd->AddPiece(flanders);
+	brd->AddPiece(barrel);
+	brd->AddPiece(pond);
+
+	auto player = brd->GetHandle(*flanders);
+	auto obstacle = brd->GetItemHandle(Vector2<int>(1, 0));
+	EXPECT_TRUE(player.IsValid());
+	EXPECT_EQ(obstacle, brd->GetHandle(*barrel));
+	EXPECT_EQ(brd->GetPiece(obstacle), barrel.get());
+	EXPECT_FALSE(brd->GetItemHandle(Vector2<int>(4, 4)).IsValid());
+
+	// Handles resolve to a fork's own copies of the pieces.
+	auto fork = brd->Fork();
+	fork->MovePiece(player, Vector2<int>(0, 1));
+	EXPECT_EQ(fork->GetPiece(player)->GetPosition(), Vector2<int>(0, 1));
+	EXPECT_EQ(flanders->GetPosition(), Vector2<int>(0, 0));
+
+	// Pushing the barrel into the water removes both of them, after
+	// which their handles no longer resolve.
+	EXPECT_TRUE(MoveCommand(flanders, Vector2<int>(1, 0)).Execute(brd));
+	EXPECT_EQ(brd->GetPiece(player)->GetPosition(), Vector2<int>(1, 0));
+	EXPECT_FALSE(brd->HasPiece(obstacle));
+	EXPECT_EQ(brd->GetPiece(obstacle), nullptr);
+	EXPECT_FALSE(brd->RemovePiece(obstacle));
+	EXPECT_TRUE(fork->HasPiece(obstacle));
+
+	EXPECT_TRUE(brd->RemovePiece(player));
+	EXPECT_FALSE(brd->HasActor(PlayerName));
+	EXPECT_FALSE(brd->GetHandle(*flanders).IsValid());
+}
+
+TEST(HappyDay, CommandStream)
+{
+	std::ostringstream errstr;
+
+	auto board = std::make_shared<Board>(parseBoard("Tests/HappyBoard.xml", errstr));
+	auto stream = parseCommandStream("Tests/HappyMoves.xml", *board, errstr);
+	auto moves = stream.ToCommands();
+	EXPECT_TRUE(errstr.str().empty());
+	EXPECT_EQ(stream.GetLength(), moves.GetLength());
+	EXPECT_EQ(sizeof(PackedCommand), 8);
+
+	// Executing the stream has the same effect as executing the
+	// command objects.
+	auto fork = board->Fork();
+	int succeeded = 0;
+	for (auto& item : moves)
+	{
+		if (item->Execute(board))
+			succeeded++;
+	}
+	EXPECT_EQ(stream.ExecuteAll(*fork), succeeded);
+	EXPECT_EQ(fork->GetStateHash(), board->GetStateHash());
+}
+
+TEST(HappyDay, ArraySlice)
+{
+	stdx::ArraySlice<int> values({ 1, 2, 3, 4, 5 });
+	auto slice = values.Slice(1, 3);
+	EXPECT_EQ(std::vector<int>(slice.begin(), slice.end()), std::vector<int>({ 2, 3, 4 }));
+	EXPECT_EQ(slice.end() - slice.begin(), 3);
+	slice[0] = 20;
+	EXPECT_EQ(values[1], 20);
+#if STDX_ARRAYSLICE_CHECKED
+	EXPECT_THROW(slice[3], std::out_of_range);
+#endif
+
+	// Moving a slice leaves an empty slice behind.
+	auto moved = std::move(slice);
+	EXPECT_EQ(moved.GetLength(), 3);
+	EXPECT_EQ(slice.GetLength(), 0);
+	EXPECT_EQ(slice.begin(), slice.end());
+	slice = std::move(moved);
+	EXPECT_EQ(slice[2], 4);
+	EXPECT_TRUE(std::vector<int>(stdx::ArraySlice<int>()).empty());
+
+	// Empty and moved-from slices can be sliced, too.
+	EXPECT_EQ(stdx::ArraySlice<int>().Slice(0, 0).GetLength(), 0);
+	EXPECT_EQ(stdx::ArraySlice<int>().Slice(0).begin(), nullptr);
+	moved = std::move(slice);
+	EXPECT_EQ(slice.Slice(0, 0).GetLength(), 0);
+	EXPECT_EQ(moved.Slice(1).GetLength(), 2);
+#if STDX_ARRAYSLICE_CHECKED
+	EXPECT_THROW(moved.Slice(2, 2), std::out_of_range);
+	EXPECT_THROW(moved.Slice(-1, 1), std::out_of_range);
+	EXPECT_THROW(stdx::ArraySlice<int>().Slice(0, 1), std::out_of_range);
+#endif
+}
+
+TEST(HappyDay, Symbols)
+{
+	Symbol wall(ObstacleName);
+	Symbol found;
+	EXPECT_EQ(wall, Symbol("wall"));
+	EXPECT_NE(wall, Symbol("ton"));
+	EXPECT_EQ(&wall.GetText(), &Symbol(std::string("wall")).GetText());
+	EXPECT_TRUE(Symbol::TryFind(ObstacleName, found));
+	EXPECT_EQ(found, wall);
+	EXPECT_FALSE(Symbol::TryFind("Flanders' other house", found));
+	EXPECT_EQ(Symbol().GetText(), "");
+
+	// Pieces keep their original spellings.
+	auto barrel = std::make_shared<Obstacle>(Vector2<int>(0, 0), "ton", true);
+	auto flanders = std::make_shared<Player>(Vector2<int>(1, 0), PlayerName);
+	EXPECT_EQ(barrel->GetObstacleType().GetText(), "ton");
+	std::ostringstream name;
+	name << flanders->GetName();
+	EXPECT_EQ(name.str(), PlayerName);
+
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(2, 1));
+	brd->AddPiece(flanders);
+	EXPECT_EQ(brd->GetActorOrNull(PlayerName), flanders);
+	EXPECT_EQ(brd->GetActorOrNull("Maude"), nullptr);
+}
+
+TEST(HappyDay, ContractPolicy)
+{
+	auto policy = GetContractPolicy();
+	SetContractPolicy(ContractPolicy::LogAndCount);
+	ResetContractViolationCount();
+
+	require_cheap(1 + 1 == 2);
+	EXPECT_EQ(GetContractViolationCount(), 0);
+	require_cheap(1 + 1 == 3);
+	ensure_linear(false);
+	EXPECT_EQ(GetContractViolationCount(), CONTRACT_LEVEL >= CONTRACT_LEVEL_LINEAR ? 2 : 1);
+
+	// A collision between pieces that are not on the board violates
+	// two cheap preconditions, but is otherwise harmless.
+	ResetContractViolationCount();
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(2, 1));
+	Collision collision(brd.get(), PieceHandle(0, 1), PieceHandle(1, 2));
+	EXPECT_EQ(GetContractViolationCount(), 2);
+	EXPECT_EQ(collision.GetMovingPiece(), nullptr);
+
+	ResetContractViolationCount();
+	SetContractPolicy(policy);
+}
+
+TEST(HappyDay, ContractProfile)
+{
+	auto& outer = RegisterContractSite("precondition", "cheap", "this->CheckInvariants()", "Outer.cpp", 12);
+	auto& inner = RegisterContractSite("postcondition", "linear", "result > 0", "Inner.cpp", 34);
+	for (int i = 0; i < 3; i++)
+	{
+		ContractTimer outerTimer(outer);
+		ContractTimer innerTimer(inner);
+	}
+	EXPECT_EQ(outer.Hits, 3);
+	EXPECT_EQ(inner.Hits, 3);
+	EXPECT_GE(outer.TotalTime, inner.TotalTime);
+	EXPECT_EQ(outer.SelfTime, outer.TotalTime - inner.TotalTime);
+
+	std::ostringstream report;
+	WriteContractProfile(report);
+	auto text = report.str();
+	auto outerLine = text.find("Outer.cpp:12: precondition 'this->CheckInvariants()'");
+	auto innerLine = text.find("Inner.cpp:34: postcondition 'result > 0'");
+	EXPECT_NE(outerLine, std::string::npos);
+	EXPECT_NE(innerLine, std::string::npos);
+	EXPECT_LT(outerLine, innerLine);
+}
+
+TEST(HappyDay, BatchRunner)
+{
+	std::istringstream manifest(
+		"# board\tactions\n"
+		"Tests/Drowning/Board.xml\tTests/Drowning/Moves.xml\n"
+		"Tests/Victory/Board.xml Tests/Victory/Moves.xml\n"
+		"\n"
+		"Tests/Level1/Board.xml\tTests/Level1/Moves.xml\n"
+		"Tests/HappyXml/Board.xml\tTests/HappyXml/Moves.xml\n"
+		"Tests/Monsters/Board.xml\tTests/Monsters/Moves.xml\n"
+		"Tests/Nonexistent/Board.xml\tTests/Nonexistent/Moves.xml\n"
+		"Tests/Level1/Board.xml\n");
+	std::vector<BatchJob> jobs;
+	std::ostringstream errstr;
+	EXPECT_FALSE(ParseBatchManifest(manifest, jobs, errstr));
+	EXPECT_EQ(trimString(errstr.str()), "Regel 9 van het manifest bevat geen bord en acties: 'Tests/Level1/Board.xml'.");
+	ASSERT_EQ(jobs.size(), 6u);
+	EXPECT_EQ(jobs[1].ActionsPath, "Tests/Victory/Moves.xml");
+
+	WorkStealingPool pool(3);
+	auto results = RunBatch(jobs, pool);
+	ASSERT_EQ(results.size(), jobs.size());
+	EXPECT_EQ(results[0].Status, BatchStatus::Loss);
+	EXPECT_EQ(results[1].Status, BatchStatus::Victory);
+	EXPECT_EQ(results[2].Status, BatchStatus::Victory);
+	EXPECT_EQ(results[3].Status, BatchStatus::Inconclusive);
+	EXPECT_EQ(results[4].Status, BatchStatus::Loss);
+	EXPECT_EQ(results[5].Status, BatchStatus::Error);
+	EXPECT_FALSE(results[5].Errors.empty());
+
+	// The results do not depend on the number of threads.
+	for (std::size_t i = 0; i < jobs.size(); i++)
+	{
+		auto expected = RunBatchJob(jobs[i]);
+		EXPECT_EQ(results[i].BoardHash, expected.BoardHash);
+		EXPECT_EQ(results[i].FailedCommandCount, expected.FailedCommandCount);
+		EXPECT_EQ(results[i].CommandCount, expected.CommandCount);
+	}
+
+	std::ostringstream output;
+	WriteBatchResult(output, jobs[2], results[2]);
+	std::ostringstream expected;
+	expected << std::hex << std::setw(16) << std::setfill('0') << results[2].BoardHash;
+	EXPECT_EQ(output.str(), "Tests/Level1/Board.xml\tTests/Level1/Moves.xml\tvictory\t" + expected.str() + "\t" + 
+		std::to_string(results[2].FailedCommandCount) + "\t" + std::to_string(results[2].CommandCount) + "\n");
+
+	// Every task runs exactly once, even when there are more threads
+	// than tasks.
+	for (int threads : { 1, 4, 16 })
+	{
+		WorkStealingPool tasks(threads);
+		std::vector<std::atomic<int>> counts(100);
+		for (auto& count : counts)
+			count = 0;
+		tasks.Run(100, [&](int Index) { counts[Index]++; });
+		for (auto& count : counts)
+			EXPECT_EQ(count, 1);
+
+		// The pool keeps its threads across batches, including empty
+		// ones.
+		tasks.Run(0, [&](int Index) { counts[Index]++; });
+		tasks.Run(7, [&](int Index) { counts[Index]++; });
+		EXPECT_EQ(std::accumulate(counts.begin(), counts.end(), 0), 107);
+	}
+}
+
+TEST(HappyDay, SimulationStats)
+{
+	BatchJob job;
+	job.BoardPath = "Tests/Level1/Board.xml";
+	job.ActionsPath = "Tests/Level1/Moves.xml";
+	auto result = RunBatchJob(job);
+	EXPECT_EQ(result.Status, BatchStatus::Victory);
+	EXPECT_GE(result.ParseTime, 0.0);
+	EXPECT_GE(result.SimulationTime, 0.0);
+
+	// Drowning removes the player from the board.
+	job.BoardPath = "Tests/Drowning/Board.xml";
+	job.ActionsPath = "Tests/Drowning/Moves.xml";
+	result = RunBatchJob(job);
+	EXPECT_EQ(result.Status, BatchStatus::Loss);
+	EXPECT_EQ(result.RemovedPieces.Players, 1);
+	EXPECT_EQ(result.RemovedPieces.Goals, 0);
+
+	result.ParseTime = 1.5;
+	result.SimulationTime = 0.25;
+	std::ostringstream csv;
+	WriteSimulationCsv(csv, result);
+	EXPECT_EQ(csv.str(), "loss," + std::to_string(result.CommandCount - result.FailedCommandCount) + "," + 
+		std::to_string(result.FailedCommandCount) + ",1,0," + std::to_string(result.RemovedPieces.Obstacles) + ",0,0,0," + 
+		std::to_string(result.RemovedPieces.Water) + ",0,1.5,0.25\n");
+
+	std::ostringstream json;
+	WriteSimulationJson(json, result);
+	EXPECT_NE(json.str().find("\"status\":\"loss\""), std::string::npos);
+	EXPECT_NE(json.str().find("\"removed\":{\"players\":1,"), std::string::npos);
+	EXPECT_NE(json.str().find("\"simulate_ms\":0.25}"), std::string::npos);
+	EXPECT_EQ(json.str().back(), '\n');
+
+	job.BoardPath = "Tests/Nonexistent/Board.xml";
+	result = RunBatchJob(job);
+	std::ostringstream error;
+	WriteSimulationJson(error, result);
+	EXPECT_NE(error.str().find("\"status\":\"error\""), std::string::npos);
+	EXPECT_NE(error.str().find("\"errors\":\""), std::string::npos);
+	EXPECT_EQ(error.str().find('\n'), error.str().size() - 1);
+}
+
+TEST(HappyDay, BoardJournal)
+{
+	// Drowning removes pieces, and Level3 opens and closes gates.
+	const char* levels[] = { "Tests/Drowning", "Tests/Level3" };
+	for (auto level : levels)
+	{
+		std::ostringstream errors;
+		auto board = std::make_shared<Board>(parseBoard((std::string(level) + "/Board.xml").c_str(), errors));
+		auto commands = parseMoves((std::string(level) + "/Moves.xml").c_str(), *board, errors);
+		ASSERT_EQ(errors.str(), "") << level;
+		auto player = board->GetHandle(**board->GetPlayers().begin());
+
+		BoardJournal journal(board);
+		std::vector<std::uint64_t> hashes;
+		std::vector<int> pieceCounts;
+		hashes.push_back(board->GetStateHash());
+		pieceCounts.push_back(board->GetPieces().size());
+		for (int i = 0; i < commands.GetLength(); i++)
+		{
+			journal.Execute(commands[i]);
+			if (journal.GetUndoCount() == (int)hashes.size())
+			{
+				hashes.push_back(board->GetStateHash());
+				pieceCounts.push_back(board->GetPieces().size());
+			}
+		}
+		ASSERT_GT(journal.GetUndoCount(), 0) << level;
+		ASSERT_EQ(journal.GetUndoCount() + 1, (int)hashes.size());
+
+		// Undo everything, and then redo everything.
+		for (int i = (int)hashes.size() - 2; i >= 0; i--)
+		{
+			EXPECT_TRUE(journal.Undo());
+			EXPECT_EQ(board->GetStateHash(), hashes[i]) << level << ", entry " << i;
+			EXPECT_EQ((int)board->GetPieces().size(), pieceCounts[i]) << level << ", entry " << i;
+			EXPECT_TRUE(board->CheckInvariants());
+		}
+		EXPECT_FALSE(journal.Undo());
+		EXPECT_TRUE(board->HasPiece(player)) << level;
+		for (int i = 1; i < (int)hashes.size(); i++)
+		{
+			EXPECT_TRUE(journal.Redo());
+			EXPECT_EQ(board->GetStateHash(), hashes[i]) << level << ", entry " << i;
+		}
+		EXPECT_FALSE(journal.Redo());
+
+		// A new command discards the entries that could be redone, and
+		// a change that the journal did not see clears the journal.
+		journal.Undo();
+		journal.Undo();
+		EXPECT_EQ(journal.GetRedoCount(), 2);
+		auto before = journal.GetUndoCount();
+		for (int i = 0; i < commands.GetLength() && journal.GetRedoCount() > 0; i++)
+			journal.Execute(commands[i]);
+		EXPECT_EQ(journal.GetRedoCount(), 0);
+		EXPECT_GE(journal.GetUndoCount(), before);
+		board->RemovePiece(*board->GetObstacles().begin());
+		EXPECT_EQ(journal.GetUndoCount(), 0);
+	}
+}
+
+TEST(HappyDay, Solver)
+{
+	// Level2 has to push barrels into water to reach its goal.
+	std::ostringstream errors;
+	auto board = std::make_shared<Board>(parseBoard("Tests/Level2/Board.xml", errors));
+	ASSERT_EQ(errors.str(), "");
+	auto initialHash = board->GetStateHash();
+	Solver solver(board);
+
+	SolverOptions options;
+	options.Algorithm = SolverAlgorithm::BreadthFirst;
+	auto breadthFirst = solver.Solve(options);
+	options.Algorithm = SolverAlgorithm::AStar;
+	auto aStar = solver.Solve(options);
+	ASSERT_EQ(breadthFirst.Status, SolverStatus::Solved);
+	ASSERT_EQ(aStar.Status, SolverStatus::Solved);
+	EXPECT_EQ(aStar.Actions.GetLength(), breadthFirst.Actions.GetLength());
+	EXPECT_LE(aStar.VisitedStates, breadthFirst.VisitedStates);
+	EXPECT_EQ(board->GetStateHash(), initialHash);
+
+	// The solution wins the game, also after a round trip through XML.
+	auto replay = board->Fork();
+	EXPECT_EQ(aStar.Actions.ExecuteAll(*replay), aStar.Actions.GetLength());
+	EXPECT_TRUE(Solver::IsVictory(replay));
+	{
+		std::ofstream output("SolverTestOutput.xml");
+		WriteActionsXml(output, aStar.Actions);
+	}
+	auto parsed = parseCommandStream("SolverTestOutput.xml", *board, errors);
+	std::remove("SolverTestOutput.xml");
+	EXPECT_EQ(errors.str(), "");
+	ASSERT_EQ(parsed.GetLength(), aStar.Actions.GetLength());
+	replay = board->Fork();
+	parsed.ExecuteAll(*replay);
+	EXPECT_TRUE(Solver::IsVictory(replay));
+
+	// States that differ only in their history are the same state.
+	auto left = board->Fork();
+	auto right = board->Fork();
+	auto player = board->GetHandle(**board->GetPlayers().begin());
+	MoveCommand::Apply(*right, player, Vector2<int>(1, 0));
+	EXPECT_NE(solver.EncodeState(*left), solver.EncodeState(*right));
+	MoveCommand::Apply(*right, player, Vector2<int>(-1, 0));
+	EXPECT_EQ(solver.EncodeState(*left), solver.EncodeState(*right));
+
+	// A tight state limit ends the search early.
+	options.MaxStates = 5;
+	EXPECT_EQ(solver.Solve(options).Status, SolverStatus::LimitReached);
+
+	// Boards without goals cannot be won.
+	auto drowning = std::make_shared<Board>(parseBoard("Tests/Drowning/Board.xml", errors));
+	EXPECT_EQ(Solver(drowning).Solve(SolverOptions()).Status, SolverStatus::Unsolvable);
+}
+
+TEST(HappyDay, ParallelSolver)
+{
+	// The table hands out one slot per hash, also under contention.
+	// Hashes zero and one share a slot, so they are left out.
+	TranspositionTable table(1000);
+	WorkStealingPool pool(4);
+	std::vector<int> slots(4000);
+	std::vector<char> isNew(slots.size());
+	pool.Run((int)slots.size(), [&](int Index)
+	{
+		bool inserted;
+		slots[Index] = table.Insert(Index % 1000 + 2, inserted);
+		isNew[Index] = inserted;
+	});
+	EXPECT_EQ(table.GetCount(), 1000);
+	EXPECT_EQ(std::count(isNew.begin(), isNew.end(), 1), 1000);
+	for (std::size_t i = 0; i < slots.size(); i++)
+		EXPECT_EQ(slots[i], table.Find(i % 1000 + 2));
+	EXPECT_EQ(table.Find(1002), -1);
+	bool inserted;
+	EXPECT_EQ(table.Insert(1002, inserted), -1);
+	EXPECT_TRUE(inserted);
+
+	// A parallel search finds a solution as short as a serial search.
+	std::ostringstream errors;
+	auto board = std::make_shared<Board>(parseBoard("Tests/Level2/Board.xml", errors));
+	ASSERT_EQ(errors.str(), "");
+	Solver solver(board);
+	SolverOptions options;
+	options.Algorithm = SolverAlgorithm::BreadthFirst;
+	auto serial = solver.Solve(options);
+	auto parallel = solver.SolveParallel(options, pool);
+	ASSERT_EQ(serial.Status, SolverStatus::Solved);
+	ASSERT_EQ(parallel.Status, SolverStatus::Solved);
+	EXPECT_EQ(parallel.Actions.GetLength(), serial.Actions.GetLength());
+	auto replay = board->Fork();
+	EXPECT_EQ(parallel.Actions.ExecuteAll(*replay), parallel.Actions.GetLength());
+	EXPECT_TRUE(Solver::IsVictory(replay));
+
+	// Threads may fork one board at the same time, and each fork owns
+	// the pieces that it modifies.
+	std::vector<std::shared_ptr<Board>> forks(16);
+	pool.Run((int)forks.size(), [&](int Index)
+	{
+		forks[Index] = board->Fork();
+		parallel.Actions.ExecuteAll(*forks[Index]);
+	});
+	for (auto& fork : forks)
+		EXPECT_TRUE(Solver::IsVictory(fork));
+	EXPECT_FALSE(Solver::IsVictory(board));
+
+	options.MaxStates = 5;
+	EXPECT_EQ(solver.SolveParallel(options, pool).Status, SolverStatus::LimitReached);
+}
+
+TEST(HappyDay, DeadCellAnalysis)
+{
+	// Only the cells in line with the button are of use to a barrel.
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(5, 3));
+	auto flanders = std::make_shared<Player>(Vector2<int>(1, 0), PlayerName);
+	brd->AddPiece(std::make_shared<Button>(Vector2<int>(2, 1)));
+	brd->AddPiece(std::make_shared<Obstacle>(Vector2<int>(2, 0), "ton", true));
+	brd->AddPiece(std::make_shared<Obstacle>(Vector2<int>(0, 2), "muur", false));
+	brd->AddPiece(flanders);
+	DeadCellAnalysis analysis(*brd);
+	EXPECT_TRUE(analysis.IsWall(Vector2<int>(0, 2)));
+	EXPECT_FALSE(analysis.IsDeadCell(Vector2<int>(1, 1)));
+	EXPECT_FALSE(analysis.IsDeadCell(Vector2<int>(3, 1)));
+	EXPECT_TRUE(analysis.IsDeadCell(Vector2<int>(0, 1)));
+	EXPECT_TRUE(analysis.IsDeadCell(Vector2<int>(2, 2)));
+	EXPECT_EQ(analysis.GetDeadCellCount(), 11);
+	EXPECT_TRUE(analysis.IsFrozenCell(Vector2<int>(0, 0)));
+	EXPECT_TRUE(analysis.IsFrozenCell(Vector2<int>(0, 1)));
+	EXPECT_TRUE(analysis.IsFrozenCell(Vector2<int>(1, 2)));
+	EXPECT_FALSE(analysis.IsFrozenCell(Vector2<int>(2, 0)));
+	EXPECT_FALSE(analysis.IsFrozenCell(Vector2<int>(4, 1)));
+
+	auto handle = brd->GetHandle(*flanders);
+	EXPECT_EQ(analysis.ClassifyPush(*brd, handle, Vector2<int>(1, 0)), PushVerdict::Wasted);
+	EXPECT_EQ(analysis.ClassifyPush(*brd, handle, Vector2<int>(0, 1)), PushVerdict::None);
+	EXPECT_EQ(analysis.ClassifyPush(*brd, handle, Vector2<int>(-1, 0)), PushVerdict::None);
+
+	// Freezing a barrel on the only way to the goal loses the game.
+	auto corridor = std::make_shared<Board>(BoardName, Vector2<int>(5, 1));
+	auto homer = std::make_shared<Player>(Vector2<int>(2, 0), PlayerName);
+	corridor->AddPiece(std::make_shared<Goal>(Vector2<int>(4, 0)));
+	corridor->AddPiece(std::make_shared<Obstacle>(Vector2<int>(3, 0), "ton", true));
+	corridor->AddPiece(homer);
+	DeadCellAnalysis corridorAnalysis(*corridor);
+	EXPECT_EQ(corridorAnalysis.ClassifyPush(*corridor, corridor->GetHandle(*homer), Vector2<int>(1, 0)), PushVerdict::Dead);
+	SolverOptions options;
+	auto pruned = Solver(corridor).Solve(options);
+	options.PruneDeadPushes = false;
+	auto unpruned = Solver(corridor).Solve(options);
+	EXPECT_EQ(pruned.Status, SolverStatus::Unsolvable);
+	EXPECT_EQ(unpruned.Status, SolverStatus::Unsolvable);
+	EXPECT_LT(pruned.VisitedStates, unpruned.VisitedStates);
+
+	// Pruning does not change the length of a solution.
+	std::ostringstream errors;
+	auto level = std::make_shared<Board>(parseBoard("Tests/Level2/Board.xml", errors));
+	ASSERT_EQ(errors.str(), "");
+	auto withPruning = Solver(level).Solve(SolverOptions());
+	ASSERT_EQ(withPruning.Status, SolverStatus::Solved);
+	EXPECT_EQ(withPruning.Actions.GetLength(), Solver(level).Solve(options).Actions.GetLength());
+}
+
+TEST(HappyDay, PieceArena)
+{
+	// Allocations are padded to the requested alignment.
+	auto arena = std::make_shared<PieceArena>(256);
+	ArenaAllocator<double> doubles(arena);
+	ArenaAllocator<std::max_align_t> maxAligned(arena);
+	for (int i = 0; i < 20; i++)
+	{
+		arena->Allocate(1 + i % 3, 1);
+		EXPECT_EQ((std::uintptr_t)doubles.allocate(1) % alignof(double), 0u);
+		EXPECT_EQ((std::uintptr_t)maxAligned.allocate(1) % alignof(std::max_align_t), 0u);
+	}
+
+	// Requests that do not fit in a block get a block of their own.
+	auto capacity = arena->GetCapacity();
+	auto large = arena->Allocate(1000, alignof(double));
+	ASSERT_NE(large, nullptr);
+	std::memset(large, 0, 1000);
+	EXPECT_GE(arena->GetCapacity(), capacity + 1000);
+	EXPECT_NE(arena->Allocate(8, 8), nullptr);
+
+	// Pieces keep their board's arena alive.
+	auto brd = std::make_shared<Board>(BoardName, Vector2<int>(3, 3));
+	auto flanders = brd->GetArena()->Create<Player>(Vector2<int>(0, 0), PlayerName);
+	brd->AddPiece(flanders);
+	std::weak_ptr<PieceArena> boardArena = brd->GetArena();
+	brd = nullptr;
+	EXPECT_FALSE(boardArena.expired());
+	flanders->Move(Vector2<int>(1, 2));
+	EXPECT_EQ(flanders->GetPosition(), Vector2<int>(1, 2));
+	EXPECT_EQ(flanders->GetName().GetText(), PlayerName);
+	flanders = nullptr;
+	EXPECT_TRUE(boardArena.expired());
+}
+
+TEST(HappyDay, SaveAfterSeek)
+{
+	std::ostringstream errors;
+	auto board = std::make_shared<Board>(parseBoard("Tests/Level3/Board.xml", errors));
+	auto commands = parseCommandStream("Tests/Level3/Moves.xml", *board, errors);
+	ASSERT_EQ(errors.str(), "");
+	CheckpointedReplay replay(board, commands, CheckpointedReplay::DefaultInterval);
+
+	// A save action writes the board that is live when it is parsed,
+	// not the board that was live when its parser was created.
+	std::shared_ptr<Board> scene = board;
+	auto parser = CreateSaveCommandParser([&] { return scene; }, [] { return std::make_shared<ASCIIArtUIHandler>(&std::cout); });
+	scene = replay.Seek(6);
+	parser->Parse("Tests/SaveAfterSeek.txt");
+
+	std::ostringstream initial, sought;
+	ASCIIArtUIHandler(&initial).Initialize(board);
+	ASCIIArtUIHandler(&sought).Initialize(replay.Seek(6));
+	ASSERT_NE(initial.str(), sought.str());
+	std::ifstream saved("Tests/SaveAfterSeek.txt");
+	std::stringstream contents;
+	contents << saved.rdbuf();
+	saved.close();
+	EXPECT_EQ(contents.str(), sought.str());
+	std::remove("Tests/SaveAfterSeek.txt");
+}
+
+TEST(HappyDay, CheckpointedReplay)
+{
+	std::ostringstream errors;
+	auto board = std::make_shared<Board>(parseBoard("Tests/Level3/Board.xml", errors));
+	auto commands = parseCommandStream("Tests/Level3/Moves.xml", *board, errors);
+	ASSERT_EQ(errors.str(), "");
+	auto initialHash = board->GetStateHash();
+
+	// Record the expected hash of every step by simply playing the
+	// commands in order.
+	std::vector<std::uint64_t> expected;
+	auto sequential = board->Fork();
+	expected.push_back(sequential->GetStateHash());
+	for (int i = 0; i < commands.GetLength(); i++)
+	{
+		commands.Execute(i, *sequential);
+		expected.push_back(sequential->GetStateHash());
+	}
+
+	CheckpointedReplay replay(board, commands, 3);
+	EXPECT_EQ(replay.GetLength(), commands.GetLength());
+	EXPECT_EQ(replay.GetCheckpointCount(), 1);
+
+	// Checkpoints are recorded lazily.
+	EXPECT_EQ(replay.Seek(7)->GetStateHash(), expected[7]);
+	EXPECT_EQ(replay.GetCheckpointCount(), 3);
+
+	// Seek backward, forward and across checkpoints.
+	int steps[] = { 0, replay.GetLength(), 1, 2, 3, 4, replay.GetLength() / 2, 5 };
+	for (int step : steps)
+		EXPECT_EQ(replay.Seek(step)->GetStateHash(), expected[step]) << "step " << step;
+	EXPECT_EQ(replay.GetCheckpointCount(), replay.GetLength() / 3 + 1);
+
+	// Modifying a sought board does not affect the replay.
+	auto sought = replay.Seek(4);
+	sought->RemovePiece(*sought->GetPlayers().begin());
+	EXPECT_EQ(replay.Seek(4)->GetStateHash(), expected[4]);
+	EXPECT_EQ(board->GetStateHash(), initialHash);
+
+	std::ostringstream output;
+	TextUIHandler handler(&output, &errors, false);
+	handler.Initialize(board);
+	auto scene = replay.Seek(replay.GetLength());
+	handler.SetScene(scene);
+	EXPECT_EQ(handler.GetScene(), scene);
+}
+
 TEST(BadOutput, NullOutput)
 {
 	std::ostringstream errstr;
@@ -260,4 +1177,22 @@ TEST(MaliciousDay, ModifiedBits)
 	char data[sizeof(Board)] = { 0 };
 	Board* badPtr = (Board*)data;
 	EXPECT_DEATH(badPtr->CheckInvariants(), AssertionFailedRegex);
+}
+
+TEST(MaliciousDay, ForeignPiece)
+{
+	// A piece belongs to the board that it was added to, and to its forks.
+	auto first = std::make_shared<Board>(BoardName, Vector2<int>(3, 3));
+	auto second = std::make_shared<Board>(BoardName, Vector2<int>(3, 3));
+	auto flanders = std::make_shared<Player>(Vector2<int>(0, 0), PlayerName);
+	EXPECT_TRUE(second->CanAddPiece(*flanders));
+	first->AddPiece(flanders);
+	EXPECT_FALSE(second->CanAddPiece(*flanders));
+	EXPECT_DEATH(second->AddPiece(flanders), AssertionFailedRegex);
+
+	auto fork = first->Fork();
+	EXPECT_TRUE(fork->RemovePiece(flanders));
+	EXPECT_TRUE(fork->CanAddPiece(*flanders));
+	EXPECT_FALSE(second->CanRestorePiece(*flanders));
+	EXPECT_FALSE(second->HasPiece(flanders));
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 // ArcadeGameUI.cpp : Defines the entry point for the console application.
 //
 
+#include <cstdlib>
 #include <functional>
 #include <memory>
 #include <sstream>
@@ -9,13 +10,16 @@
 #include <FL/Fl_Window.H>  
 #include <FL/Fl_Box.H>
 #include <FL/Fl_Button.H>
+#include <FL/Fl_Int_Input.H>
 #include <FL/Fl_Round_Button.H>
 #include <FL/Fl_Text_Display.H>
 #include <FL/Fl_Native_File_Chooser.H>
 #include "ASCIIArtUIHandler.h"
 #include "AttackCommand.h"
 #include "Board.h"
+#include "BoardJournal.h"
 #include "CGUIHandler.h"
+#include "CheckpointedReplay.h"
 #include "CompositeCommand.h"
 #include "GUIHandler.h"
 #include "HtmlUIHandler.h"
@@ -30,6 +34,14 @@ const int btnSize = 40;
 const int padding = 20;
 std::shared_ptr<GUIHandler> handler = nullptr;
 std::vector<Fl_Button*> onLoadButtons;
+std::shared_ptr<CheckpointedReplay> replay = nullptr;
+Fl_Button* gotoBtn = nullptr;
+std::shared_ptr<BoardJournal> journal = nullptr;
+
+void resetJournal()
+{
+	journal = std::make_shared<BoardJournal>(handler->GetScene());
+}
 
 void showMessage(const char* Title, const char* Message)
 {
@@ -49,7 +61,7 @@ void applyCommand(std::function<std::shared_ptr<ICommand<std::shared_ptr<Board>>
 		showMessage("Actie kon niet toegepast worden", "Acties kunnen niet toegepast worden tot het bord is ingeladen.");
 		return;
 	}
-	if (!Command()->Execute(handler->GetScene()))
+	if (!journal->Execute(Command()))
 	{
 		showMessage("Actie kon niet toegepast worden", "Een opgegeven actie was niet geldig.");
 	}
@@ -150,7 +162,11 @@ void chooseBoard(Fl_Widget*, void*)
 	else
 	{
 		handler->Initialize(board);
+		resetJournal();
 		for (Fl_Button *b : onLoadButtons) b->activate();
+		// A replay belongs to the board that it was loaded on.
+		replay = nullptr;
+		gotoBtn->deactivate();
 	}
 }
 
@@ -173,11 +189,11 @@ void chooseActions(Fl_Widget*, void*)
 		return;
 	}
 
-	CommandArray actions;
+	CommandStream actions;
 	std::ostringstream errStream;
 	try
 	{
-		actions = parseMoves(filename, *handler->GetScene(), errStream);
+		actions = parseCommandStream(filename, *handler->GetScene(), errStream);
 	}
 	catch (std::exception)
 	{
@@ -192,9 +208,14 @@ void chooseActions(Fl_Widget*, void*)
 	}
 	else
 	{
+		// Keep the actions around as a replay, so the user can go back
+		// to any step.
+		replay = std::make_shared<CheckpointedReplay>(handler->GetScene(), actions, CheckpointedReplay::DefaultInterval);
+		gotoBtn->activate();
+
 		for (int i = 0; i < actions.GetLength() && handler->GetIsInitialized(); i++)
 		{
-			if (!actions[i]->Execute(handler->GetScene()))
+			if (!actions.Execute(i, *handler->GetScene()))
 			{
 				std::stringstream message;
 				message << "Actie #" << i << " in bestand '" << filename << "' kon niet uitgevoerd worden." << std::endl;
@@ -206,6 +227,58 @@ void chooseActions(Fl_Widget*, void*)
 	}
 }
 
+void gotoStep(Fl_Widget*, void* ptr)
+{
+	Fl_Int_Input* input = (Fl_Int_Input*)ptr;
+	if (replay == nullptr)
+	{
+		showMessage("Geen acties geladen", "Er kan pas naar een stap gegaan worden nadat er acties zijn ingeladen.");
+		return;
+	}
+
+	int step = std::atoi(input->value());
+	if (*input->value() == '\0' || step < 0 || step > replay->GetLength())
+	{
+		std::stringstream message;
+		message << "De ingeladen acties tellen " << replay->GetLength() << " stappen. Geef een stap van 0 tot en met " << replay->GetLength() << " op." << std::endl;
+		showMessage("Stap bestaat niet", message.str().c_str());
+		return;
+	}
+
+	// Initialize also works after the game has ended.
+	handler->Initialize(replay->Seek(step));
+	resetJournal();
+}
+
+void undoCallback(Fl_Widget*, void*)
+{
+	if (journal == nullptr || !journal->Undo())
+	{
+		showMessage("Niets om ongedaan te maken", "Er zijn geen acties die ongedaan gemaakt kunnen worden.");
+		return;
+	}
+
+	// Undoing the action that ended the game resumes the game.
+	if (handler->GetIsInitialized())
+		handler->Display();
+	else
+		handler->Initialize(journal->GetScene());
+}
+
+void redoCallback(Fl_Widget*, void*)
+{
+	if (journal == nullptr || !journal->Redo())
+	{
+		showMessage("Niets om opnieuw uit te voeren", "Er zijn geen ongedaan gemaakte acties die opnieuw uitgevoerd kunnen worden.");
+		return;
+	}
+
+	if (handler->GetIsInitialized())
+		handler->Display();
+	else
+		handler->Initialize(journal->GetScene());
+}
+
 void outputOK(Fl_Widget*, void* ptr) {
 	// First, determine which Round_Button is selected.
 	Fl_Window *w = (Fl_Window *)ptr;
@@ -333,18 +406,46 @@ void createLoadButtons()
 	onLoadButtons.push_back(outputBtn);
 }
 
+void createUndoButtons(int Y)
+{
+	const int width = (320 - padding * 3) / 2;
+
+	Fl_Button* undoBtn = new Fl_Button(padding, Y, width, padding, "Ongedaan maken");
+	undoBtn->callback(undoCallback);
+	Fl_Button* redoBtn = new Fl_Button(padding * 2 + width, Y, width, padding, "Opnieuw");
+	redoBtn->callback(redoCallback);
+
+	onLoadButtons.push_back(undoBtn);
+	onLoadButtons.push_back(redoBtn);
+}
+
+void createGotoControls(int Y)
+{
+	const int inputWidth = 79;
+	const int labelWidth = 40;
+
+	Fl_Int_Input* stepInput = new Fl_Int_Input(padding + labelWidth, Y, inputWidth, padding, "Stap");
+	stepInput->value("0");
+	gotoBtn = new Fl_Button(padding * 2 + labelWidth + inputWidth, Y, 320 - padding * 3 - labelWidth - inputWidth, padding, "Ga naar stap");
+	gotoBtn->callback(gotoStep, stepInput);
+}
+
 int main(int argc, char* argv[])
 {
-	Fl_Window* window = new Fl_Window(320, 500, "Arcade Game");
+	const int height = 570;
+	Fl_Window* window = new Fl_Window(320, height, "Arcade Game");
 	createLoadButtons();
 	Fl_Text_Display* boardDisplay = new Fl_Text_Display(padding, padding * 3, 280, 240);
 	boardDisplay->textfont(FL_SCREEN);
 	Fl_Text_Buffer buf;
 	boardDisplay->buffer(buf);
 	handler = std::make_shared<GUIHandler>(boardDisplay);
-	createDirectionPad("Move", padding, 500 - btnSize * 4 - padding, moveLeftCallback, moveUpCallback, moveRightCallback, moveDownCallback);
-	createDirectionPad("Attack", padding * 2 + btnSize * 3, 500 - btnSize * 4 - padding, attackLeftCallback, attackUpCallback, attackRightCallback, attackDownCallback);
+	createGotoControls(padding * 4 + 240);
+	createUndoButtons(padding * 5 + 250);
+	createDirectionPad("Move", padding, height - btnSize * 4 - padding, moveLeftCallback, moveUpCallback, moveRightCallback, moveDownCallback);
+	createDirectionPad("Attack", padding * 2 + btnSize * 3, height - btnSize * 4 - padding, attackLeftCallback, attackUpCallback, attackRightCallback, attackDownCallback);
 	for (Fl_Button *b : onLoadButtons) b->deactivate();
+	gotoBtn->deactivate();
 	window->end();
 	window->show(argc, argv);
 	return Fl::run();
@@ -1,8 +1,23 @@
 #pragma once
 #include <initializer_list>
 #include <memory>
+#include <stdexcept>
 #include <vector>
 
+// Checked slices verify that every index passed to operator[], and
+// every range passed to Slice, lies within the slice, and throw an
+// std::out_of_range otherwise.
+// Unchecked slices skip that test. Slices are checked unless NDEBUG
+// is defined, but either mode can be selected explicitly by defining
+// STDX_ARRAYSLICE_CHECKED as 1 or 0.
+#ifndef STDX_ARRAYSLICE_CHECKED
+#ifdef NDEBUG
+#define STDX_ARRAYSLICE_CHECKED 0
+#else
+#define STDX_ARRAYSLICE_CHECKED 1
+#endif
+#endif
+
 namespace stdx
 {
     template<typename T>
@@ -20,10 +35,12 @@ namespace stdx
         ArraySlice(const std::vector<T>& Values);
         ArraySlice(T* Array, size_type Length);
         ArraySlice(const ArraySlice<T>& Other);
+        ArraySlice(ArraySlice<T>&& Other);
 
         T& operator[](size_type Index);
         const T& operator[](size_type Index) const;
         ArraySlice<T>& operator=(const ArraySlice<T>& Other);
+        ArraySlice<T>& operator=(ArraySlice<T>&& Other);
         operator std::vector<T>() const;
 
         ArraySlice<T> Slice(size_type Start, size_type Length) const;
@@ -31,55 +48,12 @@ namespace stdx
 
         size_type GetLength() const;
 
-        class iterator
-        {
-        public:
-            iterator(std::shared_ptr<std::vector<T>> Pointer, size_type Index) : ptr(Pointer), index(Index) { }
-            T& operator*() const { return ptr->at(index); }
-            T& operator[](offset_type Index) const { return ptr->at(index + Index); }
-            iterator& operator++() { this->index++; return *this; }
-            iterator& operator--() { this->index--; return *this; }
-            iterator operator+(offset_type Offset) const { return iterator(this->ptr, index + Offset); }
-            iterator operator-(offset_type Offset) const { return iterator(this->ptr, index - Offset); }
-            iterator& operator+=(offset_type Offset) const { this->index += Offset; return *this; }
-            iterator& operator-=(offset_type Offset) const { this->index -= Offset; return *this; }
-            bool operator==(iterator& Other) const { return this->index == Other.index; }
-            bool operator!=(iterator& Other) const { return this->index != Other.index; }
-            difference_type operator-(iterator& Other) const { return this->index - Other.index; }
-            bool operator<(iterator& Other) const { return this->index < Other.index; }
-            bool operator<=(iterator& Other) const { return this->index <= Other.index; }
-            bool operator>(iterator& Other) const { return this->index > Other.index; }
-            bool operator>=(iterator& Other) const { return this->index >= Other.index; }
-
-        private:
-            std::shared_ptr<std::vector<T>> ptr;
-            size_type index;
-        };
+        T* data();
+        const T* data() const;
 
-        class const_iterator
-        {
-        public:
-            const_iterator(std::shared_ptr<std::vector<T>> Pointer, size_type Index) : ptr(Pointer), index(Index) { }
-            const T& operator*() const { return ptr->at(index); }
-            const T& operator[](offset_type Index) const { return ptr->at(index + Index); }
-            const_iterator& operator++() { this->index++; return *this; }
-            const_iterator& operator--() { this->index--; return *this; }
-            const_iterator operator+(offset_type Offset) const { return const_iterator(this->ptr, index + Offset); }
-            const_iterator operator-(offset_type Offset) const { return const_iterator(this->ptr, index - Offset); }
-            const_iterator& operator+=(offset_type Offset) const { this->index += Offset; return *this; }
-            const_iterator& operator-=(offset_type Offset) const { this->index -= Offset; return *this; }
-            bool operator==(const_iterator& Other) const { return this->index == Other.index; }
-            bool operator!=(const_iterator& Other) const { return this->index != Other.index; }
-            difference_type operator-(const_iterator& Other) const { return this->index - Other.index; }
-            bool operator<(const_iterator& Other) const { return this->index < Other.index; }
-            bool operator<=(const_iterator& Other) const { return this->index <= Other.index; }
-            bool operator>(const_iterator& Other) const { return this->index > Other.index; }
-            bool operator>=(const_iterator& Other) const { return this->index >= Other.index; }
-
-        private:
-            std::shared_ptr<std::vector<T>> ptr;
-            size_type index;
-        };
+        // Slices are contiguous, so plain pointers serve as iterators.
+        typedef T* iterator;
+        typedef const T* const_iterator;
 
         iterator begin();
         iterator end();
@@ -92,8 +66,14 @@ namespace stdx
 
         ArraySlice(std::shared_ptr<std::vector<T>> Array, size_type Offset, size_type Length);
 
+        void CheckIndex(size_type Index) const;
+        void CheckRange(size_type Start, size_type Length) const;
+
         std::shared_ptr<std::vector<T>> ptr;
         size_type offset, length;
+        // A pointer to the slice's first element. This is cached so
+        // that iteration and element access need not go through ptr.
+        T* items;
     };
 }
 
@@ -2,13 +2,15 @@
 
 #include <initializer_list>
 #include <memory>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 using namespace stdx;
 
 template<typename T>
 ArraySlice<T>::ArraySlice()
-    : ptr(std::make_shared<std::vector<T>>()), length(0), offset(0)
+    : ptr(nullptr), length(0), offset(0), items(nullptr)
 {
 }
 
@@ -16,12 +18,14 @@ template<typename T>
 ArraySlice<T>::ArraySlice(typename ArraySlice<T>::size_type Length)
     : ptr(std::make_shared<std::vector<T>>(Length)), length(Length), offset(0)
 {
+    this->items = this->ptr->data();
 }
 
 template<typename T>
 ArraySlice<T>::ArraySlice(std::shared_ptr<std::vector<T>> Array, typename ArraySlice<T>::size_type Length)
     : ptr(Array), length(Length), offset(0)
 {
+    this->items = this->ptr->data();
 }
 
 template<typename T>
@@ -29,12 +33,14 @@ ArraySlice<T>::ArraySlice(std::initializer_list<T> Values)
     : ptr(std::make_shared<std::vector<T>>(Values)), offset(0)
 {
     this->length = this->ptr->size();
+    this->items = this->ptr->data();
 }
 
 template<typename T>
 ArraySlice<T>::ArraySlice(T* Array, typename ArraySlice<T>::size_type Length)
     : ptr(std::make_shared<std::vector<T>>(Length)), length(Length), offset(0)
 {
+    this->items = this->ptr->data();
     for (typename ArraySlice<T>::size_type i = 0; i < Length; i++)
     {
         (*this)[i] = Array[i];
@@ -45,30 +51,44 @@ template<typename T>
 ArraySlice<T>::ArraySlice(std::shared_ptr<std::vector<T>> Array, typename ArraySlice<T>::size_type Offset, typename ArraySlice<T>::size_type Length)
     : ptr(Array), length(Length), offset(Offset)
 {
+    // Empty and moved-from slices have no array to point into.
+    this->items = this->ptr != nullptr ? this->ptr->data() + Offset : nullptr;
 }
 
 template<typename T>
 ArraySlice<T>::ArraySlice(const ArraySlice<T>& Other)
-    : ptr(Other.ptr), length(Other.length), offset(Other.offset)
+    : ptr(Other.ptr), length(Other.length), offset(Other.offset), items(Other.items)
 {
 }
 
+template<typename T>
+ArraySlice<T>::ArraySlice(ArraySlice<T>&& Other)
+    : ptr(std::move(Other.ptr)), length(Other.length), offset(Other.offset), items(Other.items)
+{
+    Other.length = 0;
+    Other.offset = 0;
+    Other.items = nullptr;
+}
+
 template<typename T>
 ArraySlice<T>::ArraySlice(const std::vector<T>& Values)
     : ptr(std::make_shared<std::vector<T>>(Values)), length(Values.size()), offset(0)
 {
+    this->items = this->ptr->data();
 }
 
 template<typename T>
 T& ArraySlice<T>::operator[](typename ArraySlice<T>::size_type Index)
 {
-    return this->ptr->at(this->offset + Index);
+    this->CheckIndex(Index);
+    return this->data()[Index];
 }
 
 template<typename T>
 const T& ArraySlice<T>::operator[](typename ArraySlice<T>::size_type Index) const
 {
-    return this->ptr->at(this->offset + Index);
+    this->CheckIndex(Index);
+    return this->data()[Index];
 }
 
 template<typename T>
@@ -77,30 +97,44 @@ ArraySlice<T>& ArraySlice<T>::operator=(const ArraySlice<T>& Other)
     this->ptr = Other.ptr;
     this->length = Other.length;
     this->offset = Other.offset;
+    this->items = Other.items;
+    return *this;
+}
+
+template<typename T>
+ArraySlice<T>& ArraySlice<T>::operator=(ArraySlice<T>&& Other)
+{
+    this->ptr = std::move(Other.ptr);
+    this->length = Other.length;
+    this->offset = Other.offset;
+    this->items = Other.items;
+    Other.length = 0;
+    Other.offset = 0;
+    Other.items = nullptr;
     return *this;
 }
 
 template<typename T>
 ArraySlice<T>::operator std::vector<T>() const
 {
-    if (offset == 0 && this->GetLength() == ptr->size())
+    if (this->GetLength() == 0)
+    {
+        return std::vector<T>();
+    }
+    else if (offset == 0 && this->GetLength() == ptr->size())
     {
         return *ptr; // Fast path. Just copy the vector.
     }
     else
     {
-        std::vector<T> vals(this->GetLength()); // Slow path. Offset is not zero or length does not equal size. These things happen.
-        for (typename ArraySlice<T>::size_type i = 0; i < this->GetLength(); i++)
-        {
-            vals[i] = (*this)[i];
-        }
-        return vals;
+        return std::vector<T>(this->begin(), this->end()); // Slow path. Offset is not zero or length does not equal size. These things happen.
     }
 }
 
 template<typename T>
 ArraySlice<T> ArraySlice<T>::Slice(typename ArraySlice<T>::size_type Start, typename ArraySlice<T>::size_type Length) const
 {
+    this->CheckRange(Start, Length);
     return ArraySlice<T>(this->ptr, Start + this->offset, Length);
 }
 
@@ -116,16 +150,46 @@ typename ArraySlice<T>::size_type ArraySlice<T>::GetLength() const
     return this->length;
 }
 
+template<typename T>
+T* ArraySlice<T>::data()
+{
+    return this->items;
+}
+
+template<typename T>
+const T* ArraySlice<T>::data() const
+{
+    return this->items;
+}
+
+template<typename T>
+void ArraySlice<T>::CheckIndex(typename ArraySlice<T>::size_type Index) const
+{
+#if STDX_ARRAYSLICE_CHECKED
+    if (Index < 0 || Index >= this->length)
+        throw std::out_of_range("ArraySlice index out of range");
+#endif
+}
+
+template<typename T>
+void ArraySlice<T>::CheckRange(typename ArraySlice<T>::size_type Start, typename ArraySlice<T>::size_type Length) const
+{
+#if STDX_ARRAYSLICE_CHECKED
+    if (Start < 0 || Length < 0 || Start > this->length - Length)
+        throw std::out_of_range("ArraySlice range out of range");
+#endif
+}
+
 template<typename T>
 typename ArraySlice<T>::iterator ArraySlice<T>::begin()
 {
-    return ArraySlice<T>::iterator(this->ptr, this->offset);
+    return this->data();
 }
 
 template<typename T>
 typename ArraySlice<T>::iterator ArraySlice<T>::end()
 {
-    return ArraySlice<T>::iterator(this->ptr, this->offset + this->length);
+    return this->data() + this->length;
 }
 
 template<typename T>
@@ -143,11 +207,11 @@ typename ArraySlice<T>::const_iterator ArraySlice<T>::end() const
 template<typename T>
 typename ArraySlice<T>::const_iterator ArraySlice<T>::cbegin() const
 {
-    return ArraySlice<T>::const_iterator(this->ptr, this->offset);
+    return this->data();
 }
 
 template<typename T>
 typename ArraySlice<T>::const_iterator ArraySlice<T>::cend() const
 {
-    return ArraySlice<T>::const_iterator(this->ptr, this->offset + this->length);
+    return this->data() + this->length;
 }
\ No newline at end of file
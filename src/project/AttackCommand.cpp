@@ -48,27 +48,34 @@ bool AttackCommand::CheckInvariants() const
 bool AttackCommand::Execute(std::shared_ptr<Board> TargetBoard)
 {
     require(this->CheckInvariants());
-    auto goalPos = this->GetTarget()->GetPosition() + this->GetOffset();
-    if (!TargetBoard->InRange(goalPos))
-    {
-        bool result = false;
-        ensure(this->CheckInvariants());
-        return result;
-    }
-    auto obstacle = TargetBoard->GetItem(goalPos);
-    if (obstacle != nullptr)
-    {
-        Collision collision(TargetBoard, this->GetTarget(), obstacle);
-        bool result = obstacle->Attack(collision);
-        ensure(this->CheckInvariants());
-        return result;
-    }
-    else
-    {
-        bool result = false;
-        ensure(this->CheckInvariants());
-        return result;
-    }
+    // Look the target up by identifier, so that commands act on the
+    // target board's own copy of the actor, even if that board is a
+    // fork of the board the command was created for.
+    bool result = Apply(*TargetBoard, TargetBoard->GetHandle(*this->GetTarget()), this->GetOffset());
+    ensure(this->CheckInvariants());
+    return result;
+}
+
+/// \brief Has the piece that the given handle refers to attack the
+/// piece at the given offset on the given board, and returns a
+/// boolean that tells if the operation has completed successfully.
+/// This is what executing an attack command amounts to.
+/// \pre require(Offset != Vector2<int>());
+bool AttackCommand::Apply(Board& Scene, PieceHandle Target, Vector2<int> Offset)
+{
+    require(Offset != Vector2<int>());
+    if (!Scene.HasPiece(Target))
+        return false;
+
+    auto goalPos = Scene.GetPiece(Target)->GetPosition() + Offset;
+    if (!Scene.InRange(goalPos))
+        return false;
+
+    auto obstacle = Scene.GetItemHandle(goalPos);
+    if (!obstacle.IsValid())
+        return false;
+
+    return Scene.GetPiece(obstacle)->Attack(Collision(&Scene, Target, obstacle));
 }
 
 /// \brief Gets the move command's move offset.
@@ -0,0 +1,296 @@
+#include "BatchRunner.h"
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Board.h"
+#include "CommandStream.h"
+#include "Goal.h"
+#include "ParseXML.h"
+#include "Player.h"
+#include "WorkStealingPool.h"
+
+using namespace Arcade;
+
+namespace
+{
+    /// \brief Gets the number of milliseconds between the given points
+    /// in time.
+    double GetMilliseconds(std::chrono::steady_clock::time_point Start, std::chrono::steady_clock::time_point End)
+    {
+        return std::chrono::duration<double, std::milli>(End - Start).count();
+    }
+
+    /// \brief Writes the given string to the given stream as a quoted
+    /// JSON string.
+    void WriteJsonString(std::ostream& Stream, const std::string& Value)
+    {
+        Stream << '"';
+        for (char c : Value)
+        {
+            switch (c)
+            {
+            case '"':
+                Stream << "\\\"";
+                break;
+            case '\\':
+                Stream << "\\\\";
+                break;
+            case '\n':
+                Stream << "\\n";
+                break;
+            case '\r':
+                Stream << "\\r";
+                break;
+            case '\t':
+                Stream << "\\t";
+                break;
+            default:
+                if ((unsigned char)c < 0x20)
+                    Stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c << std::dec << std::setfill(' ');
+                else
+                    Stream << c;
+                break;
+            }
+        }
+        Stream << '"';
+    }
+}
+
+/// \brief Counts the pieces of every type on the given board.
+PieceCounts Arcade::CountPieces(const Board& Scene)
+{
+    PieceCounts result;
+    result.Players = Scene.GetPlayers().size();
+    result.Monsters = Scene.GetMonsters().size();
+    result.Obstacles = Scene.GetObstacles().size();
+    result.Gates = Scene.GetGates().size();
+    result.Buttons = Scene.GetButtons().size();
+    result.Traps = Scene.GetTraps().size();
+    result.Water = Scene.GetWater().size();
+    result.Goals = Scene.GetGoals().size();
+    return result;
+}
+
+/// \brief Gets the name of the given status, as it appears in a
+/// batch's results.
+std::string Arcade::GetBatchStatusName(BatchStatus Value)
+{
+    switch (Value)
+    {
+    case BatchStatus::Victory:
+        return "victory";
+    case BatchStatus::Inconclusive:
+        return "inconclusive";
+    case BatchStatus::Loss:
+        return "loss";
+    default:
+        return "error";
+    }
+}
+
+/// \brief Reads a batch manifest from the given stream, and appends
+/// its jobs to the given list. Every line of a manifest names a
+/// board file and an actions file, separated by a tab or, if the
+/// line contains no tabs, by whitespace. Empty lines and lines
+/// that start with '#' are skipped. Malformed lines are reported
+/// to the error stream and skipped. A boolean is returned that
+/// tells if every line was well-formed.
+bool Arcade::ParseBatchManifest(std::istream& Input, std::vector<BatchJob>& Jobs, std::ostream& ErrorStream)
+{
+    bool result = true;
+    std::string line;
+    for (int lineNumber = 1; std::getline(Input, line); lineNumber++)
+    {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        auto trimmed = trimString(line);
+        if (trimmed.empty() || trimmed[0] == '#')
+            continue;
+
+        BatchJob job;
+        std::string rest;
+        auto tab = trimmed.find('\t');
+        if (tab != std::string::npos)
+        {
+            job.BoardPath = trimString(trimmed.substr(0, tab));
+            job.ActionsPath = trimString(trimmed.substr(tab + 1));
+        }
+        else
+        {
+            std::istringstream fields(trimmed);
+            fields >> job.BoardPath >> job.ActionsPath >> rest;
+        }
+
+        if (job.BoardPath.empty() || job.ActionsPath.empty() || !rest.empty() ||
+            job.ActionsPath.find('\t') != std::string::npos)
+        {
+            ErrorStream << "Regel " << lineNumber << " van het manifest bevat geen bord en acties: '" << line << "'." << std::endl;
+            result = false;
+            continue;
+        }
+        Jobs.push_back(job);
+    }
+    return result;
+}
+
+/// \brief Parses and simulates the given job. Every job parses its
+/// own board, so jobs can safely be run concurrently.
+BatchResult Arcade::RunBatchJob(const BatchJob& Job)
+{
+    BatchResult result;
+    result.Status = BatchStatus::Error;
+    result.BoardHash = 0;
+    result.CommandCount = 0;
+    result.FailedCommandCount = 0;
+    result.RemovedPieces = PieceCounts();
+    result.ParseTime = 0;
+    result.SimulationTime = 0;
+
+    std::ostringstream errors;
+    std::shared_ptr<Board> board;
+    CommandStream commands;
+    auto parseStart = std::chrono::steady_clock::now();
+    try
+    {
+        board = std::make_shared<Board>(parseBoard(Job.BoardPath.c_str(), errors));
+        commands = parseCommandStream(Job.ActionsPath.c_str(), *board, errors);
+    }
+    catch (const std::exception& e)
+    {
+        // The parser usually writes its own error messages.
+        result.ParseTime = GetMilliseconds(parseStart, std::chrono::steady_clock::now());
+        result.Errors = errors.str().empty() ? e.what() : errors.str();
+        return result;
+    }
+    auto simulationStart = std::chrono::steady_clock::now();
+    result.ParseTime = GetMilliseconds(parseStart, simulationStart);
+
+    auto initialPieces = CountPieces(*board);
+    result.CommandCount = commands.GetLength();
+    result.FailedCommandCount = result.CommandCount - commands.ExecuteAll(*board);
+    result.BoardHash = board->GetStateHash();
+    result.Errors = errors.str();
+
+    // Pieces are only ever removed during a simulation, so the
+    // difference in counts is the number of removed pieces.
+    auto finalPieces = CountPieces(*board);
+    result.RemovedPieces.Players = initialPieces.Players - finalPieces.Players;
+    result.RemovedPieces.Monsters = initialPieces.Monsters - finalPieces.Monsters;
+    result.RemovedPieces.Obstacles = initialPieces.Obstacles - finalPieces.Obstacles;
+    result.RemovedPieces.Gates = initialPieces.Gates - finalPieces.Gates;
+    result.RemovedPieces.Buttons = initialPieces.Buttons - finalPieces.Buttons;
+    result.RemovedPieces.Traps = initialPieces.Traps - finalPieces.Traps;
+    result.RemovedPieces.Water = initialPieces.Water - finalPieces.Water;
+    result.RemovedPieces.Goals = initialPieces.Goals - finalPieces.Goals;
+
+    // This is the same verdict that UIHandlerBase::GetHasEnded and
+    // GetPlayerHasWon arrive at.
+    auto players = board->GetPlayers();
+    if (players.empty())
+    {
+        result.Status = BatchStatus::Loss;
+    }
+    else
+    {
+        result.Status = BatchStatus::Inconclusive;
+        for (auto& goal : board->GetGoals())
+            for (auto& player : players)
+                if (goal->IsPlayerVictorious(board, player))
+                    result.Status = BatchStatus::Victory;
+    }
+
+    result.SimulationTime = GetMilliseconds(simulationStart, std::chrono::steady_clock::now());
+    return result;
+}
+
+/// \brief Runs the given jobs on the given pool, and returns their
+/// results, in the same order as the jobs.
+std::vector<BatchResult> Arcade::RunBatch(const std::vector<BatchJob>& Jobs, WorkStealingPool& Pool)
+{
+    // Every task writes its own element, so no locking is needed.
+    std::vector<BatchResult> results(Jobs.size());
+    Pool.Run((int)Jobs.size(), [&](int Index)
+    {
+        results[Index] = RunBatchJob(Jobs[Index]);
+    });
+    return results;
+}
+
+/// \brief Writes the given job's result to the given stream, as a
+/// single tab-separated line: the board path, the actions path,
+/// the status, the final board hash, the number of failed actions,
+/// the number of actions and, if the job could not be parsed, the
+/// parser's error messages.
+void Arcade::WriteBatchResult(std::ostream& Stream, const BatchJob& Job, const BatchResult& Result)
+{
+    std::ostringstream hash;
+    hash << std::hex << std::setw(16) << std::setfill('0') << Result.BoardHash;
+
+    Stream << Job.BoardPath << '\t' << Job.ActionsPath << '\t'
+           << GetBatchStatusName(Result.Status) << '\t' << hash.str() << '\t'
+           << Result.FailedCommandCount << '\t' << Result.CommandCount;
+    if (Result.Status == BatchStatus::Error)
+    {
+        // Keep the result on a single line.
+        auto errors = trimString(Result.Errors);
+        for (auto& c : errors)
+            if (c == '\n' || c == '\r' || c == '\t')
+                c = ' ';
+        Stream << '\t' << errors;
+    }
+    Stream << '\n';
+}
+
+/// \brief Writes the given result to the given stream as a single
+/// line of JSON, which holds the status, the number of actions
+/// that succeeded and failed, the number of removed pieces by
+/// type, the parse and simulation times in milliseconds and, if
+/// the job could not be parsed, the parser's error messages.
+void Arcade::WriteSimulationJson(std::ostream& Stream, const BatchResult& Result)
+{
+    auto& removed = Result.RemovedPieces;
+    Stream << "{\"status\":\"" << GetBatchStatusName(Result.Status) << "\""
+           << ",\"commands\":{\"succeeded\":" << (Result.CommandCount - Result.FailedCommandCount)
+           << ",\"failed\":" << Result.FailedCommandCount << "}"
+           << ",\"removed\":{\"players\":" << removed.Players
+           << ",\"monsters\":" << removed.Monsters
+           << ",\"obstacles\":" << removed.Obstacles
+           << ",\"gates\":" << removed.Gates
+           << ",\"buttons\":" << removed.Buttons
+           << ",\"traps\":" << removed.Traps
+           << ",\"water\":" << removed.Water
+           << ",\"goals\":" << removed.Goals << "}"
+           << ",\"parse_ms\":" << Result.ParseTime
+           << ",\"simulate_ms\":" << Result.SimulationTime;
+    if (Result.Status == BatchStatus::Error)
+    {
+        Stream << ",\"errors\":";
+        WriteJsonString(Stream, trimString(Result.Errors));
+    }
+    Stream << "}\n";
+}
+
+/// \brief Writes the given result to the given stream as a single
+/// line of comma-separated values: the status, the number of
+/// actions that succeeded and failed, the number of removed
+/// players, monsters, obstacles, gates, buttons, traps, water
+/// pieces and goals, and the parse and simulation times in
+/// milliseconds.
+void Arcade::WriteSimulationCsv(std::ostream& Stream, const BatchResult& Result)
+{
+    auto& removed = Result.RemovedPieces;
+    Stream << GetBatchStatusName(Result.Status) << ','
+           << (Result.CommandCount - Result.FailedCommandCount) << ','
+           << Result.FailedCommandCount << ','
+           << removed.Players << ',' << removed.Monsters << ','
+           << removed.Obstacles << ',' << removed.Gates << ','
+           << removed.Buttons << ',' << removed.Traps << ','
+           << removed.Water << ',' << removed.Goals << ','
+           << Result.ParseTime << ',' << Result.SimulationTime << '\n';
+}
@@ -0,0 +1,116 @@
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "WorkStealingPool.h"
+
+namespace Arcade
+{
+    class Board;
+
+    /// \brief Describes a number of pieces for every type of piece.
+    struct PieceCounts
+    {
+        int Players;
+        int Monsters;
+        /// \brief The number of walls and barrels.
+        int Obstacles;
+        int Gates;
+        int Buttons;
+        int Traps;
+        int Water;
+        int Goals;
+    };
+
+    /// \brief Counts the pieces of every type on the given board.
+    PieceCounts CountPieces(const Board& Scene);
+
+    /// \brief Describes a single simulation in a batch: a board file,
+    /// and a file of actions to perform on that board.
+    struct BatchJob
+    {
+        std::string BoardPath;
+        std::string ActionsPath;
+    };
+
+    /// \brief Enumerates the ways in which a simulation can end.
+    enum class BatchStatus
+    {
+        /// \brief A player has reached a goal.
+        Victory,
+        /// \brief The game has not ended yet.
+        Inconclusive,
+        /// \brief No players are left on the board.
+        Loss,
+        /// \brief The board or actions could not be parsed.
+        Error
+    };
+
+    /// \brief Describes the outcome of a single simulation.
+    struct BatchResult
+    {
+        BatchStatus Status;
+        /// \brief The final board's state hash.
+        std::uint64_t BoardHash;
+        /// \brief The number of actions in the actions file.
+        int CommandCount;
+        /// \brief The number of actions that could not be performed.
+        int FailedCommandCount;
+        /// \brief The number of pieces of every type that were removed
+        /// from the board during the simulation.
+        PieceCounts RemovedPieces;
+        /// \brief The time spent parsing the board and actions, in
+        /// milliseconds.
+        double ParseTime;
+        /// \brief The time spent performing the actions and working out
+        /// the final status, in milliseconds.
+        double SimulationTime;
+        /// \brief The parser's error messages, if any.
+        std::string Errors;
+    };
+
+    /// \brief Gets the name of the given status, as it appears in a
+    /// batch's results.
+    std::string GetBatchStatusName(BatchStatus Value);
+
+    /// \brief Reads a batch manifest from the given stream, and appends
+    /// its jobs to the given list. Every line of a manifest names a
+    /// board file and an actions file, separated by a tab or, if the
+    /// line contains no tabs, by whitespace. Empty lines and lines
+    /// that start with '#' are skipped. Malformed lines are reported
+    /// to the error stream and skipped. A boolean is returned that
+    /// tells if every line was well-formed.
+    bool ParseBatchManifest(std::istream& Input, std::vector<BatchJob>& Jobs, std::ostream& ErrorStream);
+
+    /// \brief Parses and simulates the given job. Every job parses its
+    /// own board, so jobs can safely be run concurrently.
+    BatchResult RunBatchJob(const BatchJob& Job);
+
+    /// \brief Runs the given jobs on the given pool, and returns their
+    /// results, in the same order as the jobs.
+    std::vector<BatchResult> RunBatch(const std::vector<BatchJob>& Jobs, WorkStealingPool& Pool);
+
+    /// \brief Writes the given job's result to the given stream, as a
+    /// single tab-separated line: the board path, the actions path,
+    /// the status, the final board hash, the number of failed actions,
+    /// the number of actions and, if the job could not be parsed, the
+    /// parser's error messages.
+    void WriteBatchResult(std::ostream& Stream, const BatchJob& Job, const BatchResult& Result);
+
+    /// \brief Writes the given result to the given stream as a single
+    /// line of JSON, which holds the status, the number of actions
+    /// that succeeded and failed, the number of removed pieces by
+    /// type, the parse and simulation times in milliseconds and, if
+    /// the job could not be parsed, the parser's error messages.
+    void WriteSimulationJson(std::ostream& Stream, const BatchResult& Result);
+
+    /// \brief Writes the given result to the given stream as a single
+    /// line of comma-separated values: the status, the number of
+    /// actions that succeeded and failed, the number of removed
+    /// players, monsters, obstacles, gates, buttons, traps, water
+    /// pieces and goals, and the parse and simulation times in
+    /// milliseconds.
+    void WriteSimulationCsv(std::ostream& Stream, const BatchResult& Result);
+}
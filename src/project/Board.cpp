@@ -1,201 +1,516 @@
 #include "Board.h"
 
+#include <cstdint>
 #include <memory>
+#include <algorithm>
+#include <atomic>
 #include <string>
+#include <typeinfo>
+#include <unordered_map>
 #include <vector>
 #include "Actor.h"
+#include "Button.h"
 #include "Collision.h"
 #include "Contracts.h"
-#include "IsInstance.h"
+#include "Gate.h"
+#include "Goal.h"
+#include "IBoardObserver.h"
+#include "Monster.h"
+#include "Obstacle.h"
+#include "PieceArena.h"
 #include "PieceBase.h"
 #include "Player.h"
+#include "Symbol.h"
+#include "Trap.h"
 #include "Vector2.h"
+#include "Water.h"
 
 using namespace Arcade;
 
+/// \brief Counts the board families that have been handed out.
+static std::atomic<unsigned> nextBoardFamily(0);
+
 /// \brief Creates a new board with the given name of the given size.
-/// \pre require(Size.X > 0);
-/// \pre require(Size.Y > 0);
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Size.X > 0);
+/// \pre require_cheap(Size.Y > 0);
+/// \post ensure_cheap(this->CheckInvariants());
 Board::Board(std::string Name, Vector2<int> Size)
 {
-    require(Size.X > 0);
-    require(Size.Y > 0);
+    require_cheap(Size.X > 0);
+    require_cheap(Size.Y > 0);
     this->SetName(Name);
     this->SetSize(Size);
-    this->pcs = std::vector<std::shared_ptr<PieceBase>>();
-    ensure(this->CheckInvariants());
+    this->arena = std::make_shared<PieceArena>();
+    this->family = ++nextBoardFamily;
+    this->RebuildIndex(std::vector<std::shared_ptr<PieceBase>>());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Creates a new board with the given name of the given size
 /// containing the given pieces.
-/// \pre require(Size.X > 0);
-/// \pre require(Size.Y > 0);
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Size.X > 0);
+/// \pre require_cheap(Size.Y > 0);
+/// \pre require_cheap(this->CanAddPiece(*p)), for every piece p in
+/// Pieces.
+/// \post ensure_cheap(this->CheckInvariants());
 Board::Board(std::string Name, Vector2<int> Size, std::vector<std::shared_ptr<PieceBase>> Pieces)
 {
-    require(Size.X > 0);
-    require(Size.Y > 0);
+    require_cheap(Size.X > 0);
+    require_cheap(Size.Y > 0);
     this->SetName(Name);
     this->SetSize(Size);
-    this->pcs = Pieces;
-    ensure(this->CheckInvariants());
+    this->arena = std::make_shared<PieceArena>();
+    this->family = ++nextBoardFamily;
+    for (auto& p : Pieces)
+        require_cheap(this->CanAddPiece(*p));
+    this->RebuildIndex(Pieces);
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Adds a piece to the board.
-/// \pre require(Value->GetIsTerrain() ||
+/// \pre require_cheap(Value->GetIsTerrain() ||
 /// this->GetItem(Value->GetPosition()) == nullptr ||
 /// this->GetItem(Value->GetPosition())->GetIsTerrain());
-/// \pre require(this->InRange(Value->GetPosition()));
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->InRange(Value->GetPosition()));
+/// \pre require_cheap(this->CanAddPiece(*Value));
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void Board::AddPiece(std::shared_ptr<PieceBase> Value)
 {
-    require(Value->GetIsTerrain() || 
+    require_cheap(Value->GetIsTerrain() || 
             this->GetItem(Value->GetPosition()) == nullptr || 
             this->GetItem(Value->GetPosition())->GetIsTerrain());
-    require(this->InRange(Value->GetPosition()));
-    require(this->CheckInvariants());
-    this->pcs.push_back(Value);
-    ensure(this->CheckInvariants());
+    require_cheap(this->InRange(Value->GetPosition()));
+    require_cheap(this->CanAddPiece(*Value));
+    require_cheap(this->CheckInvariants());
+    this->RegisterPiece(Value);
+    if (!this->observers.Items.empty())
+    {
+        for (auto observer : this->observers.Items)
+            observer->PieceAdded(*this, Value);
+        this->NotifyGates();
+    }
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Gets a boolean value that tells if the given piece can be
+/// added to this board. A piece belongs to the first board that it
+/// is added to, and to that board's forks, even after it has been
+/// removed, so it cannot be added to any other board.
+bool Board::CanAddPiece(const PieceBase& Value) const
+{
+    return Value.boardFamily == 0 || Value.boardFamily == this->family;
 }
 
 /// \brief Checks if this type's invariants are being respected.
 /// A boolean value is returned that indicates whether this is
 /// indeed the case. This method is publically visible, and can
 /// be used to verify an instance's state.
+/// \remark Boards may be read by several threads at once, so this
+/// method reads fields directly instead of going through getters
+/// that would check the invariants again.
 bool Board::CheckInvariants() const
 {
-    if (!this->isCheckingInvariants)
-    {
-        this->isCheckingInvariants = true;
-        bool result = this->GetSize().X > 0 && this->GetSize().Y > 0;
-        this->isCheckingInvariants = false;
-        return result;
-    }
-    return true;
+    // A board without a positive size is corrupt, so the check fails
+    // loudly, just like the size's getter does.
+    auto size = this->Size_value;
+    ensure_cheap(size.X > 0);
+    ensure_cheap(size.Y > 0);
+    return (int)this->grid.size() == size.X * size.Y;
 }
 
 /// \brief Gets the first actor with the given name.
-/// \pre require(this->HasActor(Name));
-/// \pre require(this->CheckInvariants());
-/// \post ensure(result != nullptr);
-/// \post ensure(this->InRange(result->GetPosition()));
+/// \pre require_cheap(this->HasActor(Name));
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(result != nullptr);
+/// \post ensure_cheap(this->InRange(result->GetPosition()));
 std::shared_ptr<Actor> Board::GetActor(std::string Name) const
 {
-    require(this->HasActor(Name));
-    require(this->CheckInvariants());
+    require_cheap(this->HasActor(Name));
+    require_cheap(this->CheckInvariants());
     auto result = this->GetActorOrNull(Name);
-    ensure(result != nullptr);
-    ensure(this->InRange(result->GetPosition()));
+    ensure_cheap(result != nullptr);
+    ensure_cheap(this->InRange(result->GetPosition()));
     return result;
 }
 
 /// \brief Gets the first actor with the given name if they can be
 /// found. Otherwise, null.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(result == nullptr || this->InRange(result->GetPosition()));
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(result == nullptr || this->InRange(result->GetPosition()));
 std::shared_ptr<Actor> Board::GetActorOrNull(std::string Name) const
 {
-    require(this->CheckInvariants());
-    for (auto& item : this->GetPieces())
-        if (stdx::isinstance<Actor>(item))
-        {
-            auto actor = std::dynamic_pointer_cast<Actor>(item);
-            if (actor->GetName() == Name)
+    require_cheap(this->CheckInvariants());
+    std::shared_ptr<Actor> result = nullptr;
+    // A name that has never been interned cannot belong to an actor.
+    Symbol name;
+    auto entry = this->actorsByName->end();
+    if (Symbol::TryFind(Name, name))
+        entry = this->actorsByName->find(name);
+    if (entry != this->actorsByName->end())
+        for (int slot : entry->second)
+            if (this->pcs.Items[slot] != nullptr)
             {
-                auto result = actor;
-                ensure(result == nullptr || this->InRange(result->GetPosition()));
-                return result;
+                result = std::static_pointer_cast<Actor>(this->pcs.Items[slot]);
+                break;
             }
-        }
-    std::shared_ptr<Actor> result = nullptr;
-    ensure(result == nullptr || this->InRange(result->GetPosition()));
+
+    ensure_cheap(result == nullptr || this->InRange(result->GetPosition()));
     return result;
 }
 
 /// \brief Gets all players on the board.
-/// \pre require(this->CheckInvariants());
-std::vector<std::shared_ptr<Player>> Board::GetPlayers() const
+/// \pre require_cheap(this->CheckInvariants());
+PieceView<Player> Board::GetPlayers() const
+{
+    require_cheap(this->CheckInvariants());
+    return PieceView<Player>(this->players.Items, this->players.Count);
+}
+
+/// \brief Gets all monsters on the board.
+/// \pre require_cheap(this->CheckInvariants());
+PieceView<Monster> Board::GetMonsters() const
+{
+    require_cheap(this->CheckInvariants());
+    return PieceView<Monster>(this->monsters.Items, this->monsters.Count);
+}
+
+/// \brief Gets all goals on the board.
+/// \pre require_cheap(this->CheckInvariants());
+PieceView<Goal> Board::GetGoals() const
+{
+    require_cheap(this->CheckInvariants());
+    return PieceView<Goal>(this->goals.Items, this->goals.Count);
+}
+
+/// \brief Gets all gates on the board.
+/// \pre require_cheap(this->CheckInvariants());
+PieceView<Gate> Board::GetGates() const
+{
+    require_cheap(this->CheckInvariants());
+    return PieceView<Gate>(this->gates.Items, this->gates.Count);
+}
+
+/// \brief Gets all buttons on the board.
+/// \pre require_cheap(this->CheckInvariants());
+PieceView<Button> Board::GetButtons() const
+{
+    require_cheap(this->CheckInvariants());
+    return PieceView<Button>(this->buttons.Items, this->buttons.Count);
+}
+
+/// \brief Gets all traps on the board.
+/// \pre require_cheap(this->CheckInvariants());
+PieceView<Trap> Board::GetTraps() const
+{
+    require_cheap(this->CheckInvariants());
+    return PieceView<Trap>(this->traps.Items, this->traps.Count);
+}
+
+/// \brief Gets all water pieces on the board.
+/// \pre require_cheap(this->CheckInvariants());
+PieceView<Water> Board::GetWater() const
+{
+    require_cheap(this->CheckInvariants());
+    return PieceView<Water>(this->water.Items, this->water.Count);
+}
+
+/// \brief Gets all plain obstacles, i.e. walls and barrels, on the
+/// board.
+/// \pre require_cheap(this->CheckInvariants());
+PieceView<Obstacle> Board::GetObstacles() const
+{
+    require_cheap(this->CheckInvariants());
+    return PieceView<Obstacle>(this->obstacles.Items, this->obstacles.Count);
+}
+
+/// \brief Gets the arena that this board's pieces can be
+/// allocated from. Allocating all of a board's pieces in its
+/// arena keeps them close together in memory. The arena is
+/// shared with the board's forks.
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(result != nullptr);
+std::shared_ptr<PieceArena> Board::GetArena() const
 {
-    require(this->CheckInvariants());
-    std::vector<std::shared_ptr<Player>> results;
-    for (auto& item : this->GetPieces())
-        if (stdx::isinstance<Player>(item))
-            results.push_back(std::dynamic_pointer_cast<Player>(item));
+    require_cheap(this->CheckInvariants());
+    auto result = this->arena;
+    ensure_cheap(result != nullptr);
+    return result;
+}
+
+/// \brief Gets the first gate on this board that has the given
+/// button as one of its associated buttons, if any. Otherwise,
+/// null. This takes constant time.
+/// \pre require_cheap(this->CheckInvariants());
+std::shared_ptr<Gate> Board::GetAssociatedGate(const Button& Value) const
+{
+    require_cheap(this->CheckInvariants());
+    auto entry = this->gatesByButton->find(Value.GetId());
+    if (entry == this->gatesByButton->end())
+        return nullptr;
+    else
+        return this->gates.Items[entry->second.front()];
+}
 
-    return results;
+/// \brief Gets the number of the given gate's associated buttons
+/// that are currently pressed, i.e. that share their position
+/// with a non-terrain piece. This count is kept up to date as
+/// pieces move, so reading it takes constant time. If the gate
+/// is not on this board, -1 is returned.
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(result >= -1);
+int Board::GetPressedButtonCount(const Gate& Value) const
+{
+    require_cheap(this->CheckInvariants());
+    int slot = this->GetSlot(Value);
+    int result = slot < 0 ? -1 : this->pressedButtons[this->slots[slot].TypeOrder];
+    ensure_cheap(result >= -1);
+    return result;
 }
 
 /// \brief Gets a boolean value that tells if this board contains the
 /// given actor.
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
 bool Board::HasActor(std::string Name) const
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     return this->GetActorOrNull(Name) != nullptr;
 }
 
 /// \brief Gets a boolean value that tells if this board contains the
 /// given piece.
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
 bool Board::HasPiece(std::shared_ptr<PieceBase> Value) const
 {
-    require(this->CheckInvariants());
-    for (auto& p : this->GetPieces())
-        if (p == Value)
-            return true;
+    require_cheap(this->CheckInvariants());
+    return Value != nullptr && this->GetSlot(*Value) >= 0;
+}
 
-    return false;
+/// \brief Gets a boolean value that tells if the piece that the
+/// given handle refers to is on this board.
+/// \pre require_cheap(this->CheckInvariants());
+bool Board::HasPiece(PieceHandle Value) const
+{
+    require_cheap(this->CheckInvariants());
+    if (Value.Index < 0 || Value.Index >= this->pcs.Items.size())
+        return false;
+
+    auto& item = this->pcs.Items[Value.Index];
+    return item != nullptr && item->GetId() == Value.Generation;
+}
+
+/// \brief Gets a handle to the given piece. If the piece is not
+/// on this board, an invalid handle is returned.
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(!result.IsValid() || this->HasPiece(result));
+PieceHandle Board::GetHandle(const PieceBase& Value) const
+{
+    require_cheap(this->CheckInvariants());
+    int slot = this->GetSlot(Value);
+    PieceHandle result = slot >= 0 ? PieceHandle(slot, Value.GetId()) : PieceHandle();
+    ensure_cheap(!result.IsValid() || this->HasPiece(result));
+    return result;
+}
+
+/// \brief Gets the piece that the given handle refers to, or null
+/// if that piece is not on this board. The board keeps
+/// ownership of the piece: the pointer is invalidated when
+/// the piece is moved or removed.
+/// \pre require_cheap(this->CheckInvariants());
+PieceBase* Board::GetPiece(PieceHandle Value) const
+{
+    require_cheap(this->CheckInvariants());
+    if (!this->HasPiece(Value))
+        return nullptr;
+
+    return this->pcs.Items[Value.Index].get();
 }
 
 /// \brief Gets a boolean value that indicates whether the given
 /// point is in the board or not.
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
 bool Board::InRange(Vector2<int> Point) const
 {
-    require(this->CheckInvariants());
-    return Point.X >= 0 && Point.Y >= 0 && Point.X < this->GetWidth() && Point.Y < this->GetHeight();
+    require_cheap(this->CheckInvariants());
+    return Point.X >= 0 && Point.Y >= 0 && Point.X < this->Size_value.X && Point.Y < this->Size_value.Y;
+}
+
+/// \brief Gets this board's counterpart of the given piece, i.e.
+/// the piece on this board that has the same identifier. If
+/// there is no such piece, null is returned.
+/// \pre require_cheap(Value != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(result == nullptr || result->GetId() == Value->GetId());
+std::shared_ptr<PieceBase> Board::ResolvePiece(std::shared_ptr<PieceBase> Value) const
+{
+    require_cheap(Value != nullptr);
+    require_cheap(this->CheckInvariants());
+    int slot = this->GetSlot(*Value);
+    std::shared_ptr<PieceBase> result = nullptr;
+    if (slot >= 0)
+        result = this->pcs.Items[slot];
+    ensure_cheap(result == nullptr || result->GetId() == Value->GetId());
+    return result;
+}
+
+/// \brief Gets this board's counterpart of the given actor, i.e.
+/// the actor on this board that has the same identifier. If
+/// there is no such actor, null is returned.
+/// \pre require_cheap(Value != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+std::shared_ptr<Actor> Board::ResolveActor(std::shared_ptr<Actor> Value) const
+{
+    require_cheap(Value != nullptr);
+    require_cheap(this->CheckInvariants());
+    return std::static_pointer_cast<Actor>(this->ResolvePiece(Value));
+}
+
+/// \brief Creates a copy-on-write fork of this board. Creating a
+/// fork takes constant time, and the cost of modifying either
+/// board afterwards is proportional to the number of pieces
+/// that are modified, rather than to the size of the board.
+/// Pieces are copied before they are first modified on either
+/// board, so piece pointers that were obtained before the fork
+/// may go stale. Use ResolvePiece to find a piece's current
+/// counterpart on a board.
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(result->GetStateHash() == this->GetStateHash());
+std::shared_ptr<Board> Board::Fork() const
+{
+    require_cheap(this->CheckInvariants());
+    auto result = std::make_shared<Board>(*this);
+    ensure_cheap(result->GetStateHash() == this->GetStateHash());
+    return result;
+}
+
+/// \brief Subscribes the given observer to this board's change
+/// events. The board does not own its observers, so an observer
+/// must unsubscribe before it is destroyed. Forks of a board do
+/// not inherit its observers.
+/// \pre require_cheap(Observer != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+void Board::Subscribe(IBoardObserver* Observer)
+{
+    require_cheap(Observer != nullptr);
+    require_cheap(this->CheckInvariants());
+    this->observers.Items.push_back(Observer);
+}
+
+/// \brief Unsubscribes the given observer from this board's
+/// change events, and returns a boolean that tells if the
+/// observer was subscribed.
+/// \pre require_cheap(this->CheckInvariants());
+bool Board::Unsubscribe(IBoardObserver* Observer)
+{
+    require_cheap(this->CheckInvariants());
+    auto& items = this->observers.Items;
+    auto position = std::find(items.begin(), items.end(), Observer);
+    if (position == items.end())
+        return false;
+
+    items.erase(position);
+    return true;
 }
 
 /// \brief Removes a piece from the board, and returns a boolean that
 /// tells if the piece has been removed.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(!this->HasPiece(Value));
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(!this->HasPiece(Value));
+/// \post ensure_cheap(this->CheckInvariants());
 bool Board::RemovePiece(std::shared_ptr<PieceBase> Value)
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
+    bool result = Value != nullptr && this->RemovePiece(this->GetHandle(*Value));
+    ensure_cheap(!this->HasPiece(Value));
+    ensure_cheap(this->CheckInvariants());
+    return result;
+}
+
+/// \brief Removes the piece that the given handle refers to from
+/// the board, and returns a boolean that tells if the piece has
+/// been removed. If the board held the last reference to the
+/// piece, the piece is destroyed, so a piece that removes
+/// itself must not access its own state afterwards.
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(!this->HasPiece(Value));
+/// \post ensure_cheap(this->CheckInvariants());
+bool Board::RemovePiece(PieceHandle Value)
+{
+    require_cheap(this->CheckInvariants());
     if (!this->HasPiece(Value))
     {
         bool result = false;
-        ensure(!this->HasPiece(Value));
-        ensure(this->CheckInvariants());
+        ensure_cheap(!this->HasPiece(Value));
+        ensure_cheap(this->CheckInvariants());
         return result;
     }
-    int i = 0;
-    while (this->pcs[i] != Value)
-        ++i;
-    while (i < (int)this->pcs.size() - 1)
+    auto removed = this->UnregisterPiece(Value.Index);
+    if (!this->observers.Items.empty())
     {
-        this->pcs[i] = this->pcs[i + 1];
-        ++i;
+        for (auto observer : this->observers.Items)
+            observer->PieceRemoved(*this, removed);
+        this->NotifyGates();
     }
-    this->pcs.pop_back();
     bool result = true;
-    ensure(!this->HasPiece(Value));
-    ensure(this->CheckInvariants());
+    ensure_cheap(!this->HasPiece(Value));
+    ensure_cheap(this->CheckInvariants());
     return result;
 }
 
+/// \brief Gets a boolean value that tells if the given piece has
+/// been removed from this board, and can be put back in the
+/// slot that it was removed from.
+/// \pre require_cheap(this->CheckInvariants());
+bool Board::CanRestorePiece(const PieceBase& Value) const
+{
+    require_cheap(this->CheckInvariants());
+    // A slot is never reused, so an empty slot of the same kind can
+    // only have held this piece or a copy of it.
+    int slot = Value.boardSlot;
+    return Value.boardFamily == this->family &&
+           slot >= 0 && slot < this->pcs.Items.size() &&
+           this->pcs.Items[slot] == nullptr &&
+           this->slots[slot].KindHash == GetKindHash(Value);
+}
+
+/// \brief Puts a piece that has been removed from this board back
+/// in the slot that it was removed from, so handles to the
+/// piece become valid again. This undoes a removal.
+/// \pre require_cheap(Value != nullptr);
+/// \pre require_cheap(this->CanRestorePiece(*Value));
+/// \pre require_cheap(Value->GetIsTerrain() ||
+/// this->GetItem(Value->GetPosition()) == nullptr ||
+/// this->GetItem(Value->GetPosition())->GetIsTerrain());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->HasPiece(Value));
+/// \post ensure_cheap(this->CheckInvariants());
+void Board::RestorePiece(std::shared_ptr<PieceBase> Value)
+{
+    require_cheap(Value != nullptr);
+    require_cheap(this->CanRestorePiece(*Value));
+    require_cheap(Value->GetIsTerrain() || 
+            this->GetItem(Value->GetPosition()) == nullptr || 
+            this->GetItem(Value->GetPosition())->GetIsTerrain());
+    require_cheap(this->CheckInvariants());
+    this->ReregisterPiece(Value);
+    if (!this->observers.Items.empty())
+    {
+        for (auto observer : this->observers.Items)
+            observer->PieceAdded(*this, Value);
+        this->NotifyGates();
+    }
+    ensure_cheap(this->HasPiece(Value));
+    ensure_cheap(this->CheckInvariants());
+}
+
 /// \brief Gets the board's height.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(result > 0);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(result > 0);
 int Board::GetHeight() const
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     int result = this->GetSize().Y;
-    ensure(result > 0);
+    ensure_cheap(result > 0);
     return result;
 }
 
@@ -203,33 +518,45 @@ int Board::GetHeight() const
 /// If no piece is found, return null.
 /// If the given position contains one or more terrain pieces
 /// and one other piece, the latter is returned.
-/// \pre require(this->InRange(pos));
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->InRange(pos));
+/// \pre require_cheap(this->CheckInvariants());
 std::shared_ptr<PieceBase> Board::GetItem(Vector2<int> pos) const
 {
-    require(this->InRange(pos));
-    require(this->CheckInvariants());
-    std::shared_ptr<PieceBase> terrainPiece = nullptr;
-    for (auto& p : this->GetPieces())
-        if (p->GetPosition() == pos)
-        {
-            if (p->GetIsTerrain())
-                terrainPiece = p;
-            else
-                return p;
+    require_cheap(this->InRange(pos));
+    require_cheap(this->CheckInvariants());
+    auto& cell = this->grid[this->GetCellIndex(pos)];
+    int slot = cell.Occupant >= 0 ? cell.Occupant : cell.Terrain;
+    if (slot >= 0)
+        return this->pcs.Items[slot];
+    else
+        return nullptr;
+}
 
-        }
-    return terrainPiece;
+/// \brief Gets a handle to the piece at the given coordinates,
+/// i.e. the piece that GetItem returns. If no piece is found,
+/// an invalid handle is returned.
+/// \pre require_cheap(this->InRange(pos));
+/// \pre require_cheap(this->CheckInvariants());
+PieceHandle Board::GetItemHandle(Vector2<int> pos) const
+{
+    require_cheap(this->InRange(pos));
+    require_cheap(this->CheckInvariants());
+    auto& cell = this->grid[this->GetCellIndex(pos)];
+    int slot = cell.Occupant >= 0 ? cell.Occupant : cell.Terrain;
+    if (slot >= 0)
+        return PieceHandle(slot, this->pcs.Items[slot]->GetId());
+    else
+        return PieceHandle();
 }
 
 /// \brief Find the piece at the given coordinates.
 /// If no piece is found, return null.
-/// \pre require(this->InRange(Vector2<int>(X, Y)));
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->InRange(Vector2<int>(X, Y)));
+/// \pre require_cheap(this->CheckInvariants());
 std::shared_ptr<PieceBase> Board::GetItem(int X, int Y) const
 {
-    require(this->InRange(Vector2<int>(X, Y)));
-    require(this->CheckInvariants());
+    require_cheap(this->InRange(Vector2<int>(X, Y)));
+    require_cheap(this->CheckInvariants());
     return this->GetItem(Vector2<int>(X, Y));
 }
 
@@ -240,31 +567,46 @@ void Board::SetName(std::string value)
 }
 
 /// \brief Gets the field's name.
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
 std::string Board::GetName() const
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     return this->Name_value;
 }
 
-/// \brief Gets all pieces on the board.
-/// \pre require(this->CheckInvariants());
-std::vector<std::shared_ptr<PieceBase>> Board::GetPieces() const
+/// \brief Gets a 64-bit hash of the board's state. The hash
+/// covers every piece's type, position and movability, and
+/// does not depend on the order in which pieces were added.
+/// It is updated incrementally as pieces are added, removed
+/// and moved.
+/// \pre require_cheap(this->CheckInvariants());
+std::uint64_t Board::GetStateHash() const
 {
-    require(this->CheckInvariants());
-    return this->pcs;
+    require_cheap(this->CheckInvariants());
+    return this->stateHash;
+}
+
+/// \brief Gets a view of all pieces on the board, in the order
+/// in which they were added. The view does not copy the
+/// board's pieces, and is invalidated when the board is
+/// modified.
+/// \pre require_cheap(this->CheckInvariants());
+PieceView<PieceBase> Board::GetPieces() const
+{
+    require_cheap(this->CheckInvariants());
+    return PieceView<PieceBase>(this->pcs.Items, this->pcs.Count);
 }
 
 /// \brief Gets the board's dimensions.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(result.X > 0);
-/// \post ensure(result.Y > 0);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(result.X > 0);
+/// \post ensure_cheap(result.Y > 0);
 Vector2<int> Board::GetSize() const
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     auto result = this->Size_value;
-    ensure(result.X > 0);
-    ensure(result.Y > 0);
+    ensure_cheap(result.X > 0);
+    ensure_cheap(result.Y > 0);
     return result;
 }
 
@@ -275,12 +617,600 @@ void Board::SetSize(Vector2<int> value)
 }
 
 /// \brief Gets the board's width.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(result > 0);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(result > 0);
 int Board::GetWidth() const
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     int result = this->GetSize().X;
-    ensure(result > 0);
+    ensure_cheap(result > 0);
+    return result;
+}
+
+/// \brief Moves the given piece to the given target position, and
+/// updates the board's spatial index accordingly.
+/// If the piece is shared with a fork of this board, then this
+/// board's counterpart of the piece is copied before it is
+/// moved. Pieces that are not on this board are moved as well,
+/// but are not indexed.
+/// \pre require_cheap(Value != nullptr);
+/// \pre require_cheap(this->InRange(Target));
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap((this->HasPiece(Value) ? this->ResolvePiece(Value) : Value)->GetPosition() == Target);
+/// \post ensure_cheap(this->CheckInvariants());
+void Board::MovePiece(std::shared_ptr<PieceBase> Value, Vector2<int> Target)
+{
+    require_cheap(Value != nullptr);
+    require_cheap(this->InRange(Target));
+    require_cheap(this->CheckInvariants());
+    auto handle = this->GetHandle(*Value);
+    if (handle.IsValid())
+        this->MovePiece(handle, Target);
+    else
+        Value->Move(Target);
+    ensure_cheap((this->HasPiece(Value) ? this->ResolvePiece(Value) : Value)->GetPosition() == Target);
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Moves the piece that the given handle refers to to the
+/// given target position, and updates the board's spatial index
+/// accordingly. If the piece is shared with a fork of this
+/// board, it is copied before it is moved.
+/// \pre require_cheap(this->HasPiece(Value));
+/// \pre require_cheap(this->InRange(Target));
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->GetPiece(Value)->GetPosition() == Target);
+/// \post ensure_cheap(this->CheckInvariants());
+void Board::MovePiece(PieceHandle Value, Vector2<int> Target)
+{
+    require_cheap(this->HasPiece(Value));
+    require_cheap(this->InRange(Target));
+    require_cheap(this->CheckInvariants());
+    int slot = Value.Index;
+    auto piece = this->GetWritablePiece(slot);
+    auto source = piece->GetPosition();
+    piece->Move(Target);
+    this->UnindexPiece(slot, *piece, source);
+    this->IndexPiece(slot, *piece, Target);
+    auto kind = this->slots[slot].KindHash;
+    this->stateHash ^= GetPieceHash(kind, source) ^ GetPieceHash(kind, Target);
+    if (!this->observers.Items.empty())
+    {
+        for (auto observer : this->observers.Items)
+            observer->PieceMoved(*this, this->pcs.Items[slot], source, Target);
+        this->NotifyGates();
+    }
+    ensure_cheap(this->GetPiece(Value)->GetPosition() == Target);
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Gets the index of the given position in the spatial index.
+int Board::GetCellIndex(Vector2<int> Position) const
+{
+    return Position.Y * this->Size_value.X + Position.X;
+}
+
+/// \brief Gets the slot of the given piece on this board, or -1
+/// if the piece is not on this board.
+int Board::GetSlot(const PieceBase& Value) const
+{
+    // A piece remembers the board family and the slot that it was
+    // added to. It cannot be added to another family, and forks share
+    // their slots, so the slot is the same on every board that can
+    // hold the piece. Copies made for forks share that slot too, so
+    // the piece's identifier tells them apart from unrelated pieces.
+    int slot = Value.boardSlot;
+    if (Value.boardFamily == this->family && slot >= 0 && slot < this->pcs.Items.size())
+    {
+        auto& item = this->pcs.Items[slot];
+        if (item != nullptr && item->GetId() == Value.GetId())
+            return slot;
+    }
+    return -1;
+}
+
+/// \brief Gets the piece in the given slot, and makes sure that
+/// it is owned by this board by copying it if necessary.
+PieceBase* Board::GetWritablePiece(int Index)
+{
+    auto info = this->slots[Index];
+    if (info.Owner == this->ownerTag.Get())
+        return this->pcs.Items[Index].get();
+
+    auto copy = this->pcs.Items[Index]->Clone();
+    this->pcs.Items.GetMutable(Index) = copy;
+    this->slots.GetMutable(Index).Owner = this->ownerTag.Get();
+    if (typeid(*copy) == typeid(Obstacle))
+        this->obstacles.Items.GetMutable(info.TypeOrder) = std::static_pointer_cast<Obstacle>(copy);
+    else
+        ReplaceInRegistry(this->players, copy, info) || 
+        ReplaceInRegistry(this->monsters, copy, info) || 
+        ReplaceInRegistry(this->goals, copy, info) || 
+        ReplaceInRegistry(this->gates, copy, info) || 
+        ReplaceInRegistry(this->buttons, copy, info) || 
+        ReplaceInRegistry(this->traps, copy, info) || 
+        ReplaceInRegistry(this->water, copy, info);
+    return copy.get();
+}
+
+/// \brief Adds the piece in the given slot to the spatial index,
+/// at the given position.
+void Board::IndexPiece(int Index, const PieceBase& Value, Vector2<int> Position)
+{
+    int index = this->GetCellIndex(Position);
+    auto& cell = this->grid.GetMutable(index);
+    if (Value.GetIsTerrain())
+    {
+        if (++cell.TerrainCount == 1)
+            cell.Terrain = Index;
+        else
+            this->RescanCell(cell, Position, true);
+    }
+    else
+    {
+        if (++cell.OccupantCount == 1)
+        {
+            cell.Occupant = Index;
+            if (cell.GateCount > 0)
+                this->UpdateGates(index, 1);
+        }
+        else
+            this->RescanCell(cell, Position, false);
+    }
+}
+
+/// \brief Removes the piece in the given slot from the spatial
+/// index, at the given position.
+void Board::UnindexPiece(int Index, const PieceBase& Value, Vector2<int> Position)
+{
+    int index = this->GetCellIndex(Position);
+    auto& cell = this->grid.GetMutable(index);
+    if (Value.GetIsTerrain())
+    {
+        if (--cell.TerrainCount == 0)
+            cell.Terrain = -1;
+        else if (cell.Terrain == Index)
+            this->RescanCell(cell, Position, true);
+    }
+    else
+    {
+        if (--cell.OccupantCount == 0)
+        {
+            cell.Occupant = -1;
+            if (cell.GateCount > 0)
+                this->UpdateGates(index, -1);
+        }
+        else if (cell.Occupant == Index)
+            this->RescanCell(cell, Position, false);
+    }
+}
+
+/// \brief Rebuilds one of the given cell's slots from the piece
+/// list. This is only necessary when more than one piece of
+/// the same kind shares a cell.
+void Board::RescanCell(Cell& Target, Vector2<int> Position, bool Terrain)
+{
+    int result = -1;
+    int slot = 0;
+    for (auto& p : this->pcs.Items)
+    {
+        if (p != nullptr && p->GetPosition() == Position && p->GetIsTerrain() == Terrain)
+        {
+            // Terrain slots hold the last terrain piece, occupant
+            // slots hold the first non-terrain piece.
+            result = slot;
+            if (!Terrain)
+                break;
+        }
+        slot++;
+    }
+    if (Terrain)
+        Target.Terrain = result;
+    else
+        Target.Occupant = result;
+}
+
+/// \brief Makes the gate with the given registry index watch the
+/// positions of its associated buttons, counts the buttons that
+/// are currently pressed, and links the buttons back to the
+/// gate.
+void Board::BindGate(const Gate& Value, int Order)
+{
+    if (this->gatesByButtonCell.use_count() != 1)
+        this->gatesByButtonCell = std::make_shared<std::unordered_map<int, std::vector<int>>>(*this->gatesByButtonCell);
+    if (this->gatesByButton.use_count() != 1)
+        this->gatesByButton = std::make_shared<std::unordered_map<int, std::vector<int>>>(*this->gatesByButton);
+
+    // Buttons never move, so a gate only needs to watch the cells
+    // its buttons occupy.
+    int pressed = 0;
+    for (auto& button : Value.GetAssociatedButtons())
+    {
+        auto& linked = (*this->gatesByButton)[button->GetId()];
+        if (linked.empty() || linked.back() != Order)
+            linked.push_back(Order);
+
+        if (!this->InRange(button->GetPosition()))
+            continue;
+
+        int index = this->GetCellIndex(button->GetPosition());
+        (*this->gatesByButtonCell)[index].push_back(Order);
+        auto& cell = this->grid.GetMutable(index);
+        cell.GateCount++;
+        if (cell.OccupantCount > 0)
+            pressed++;
+    }
+    // A gate that is bound again after it has been removed keeps its
+    // registry index.
+    if (Order < (int)this->pressedButtons.size())
+        this->pressedButtons.GetMutable(Order) = pressed;
+    else
+        this->pressedButtons.push_back(pressed);
+}
+
+/// \brief Makes the gate with the given registry index stop
+/// watching the positions of its associated buttons, and
+/// unlinks the buttons from the gate.
+void Board::UnbindGate(const Gate& Value, int Order)
+{
+    if (this->gatesByButtonCell.use_count() != 1)
+        this->gatesByButtonCell = std::make_shared<std::unordered_map<int, std::vector<int>>>(*this->gatesByButtonCell);
+    if (this->gatesByButton.use_count() != 1)
+        this->gatesByButton = std::make_shared<std::unordered_map<int, std::vector<int>>>(*this->gatesByButton);
+
+    for (auto& button : Value.GetAssociatedButtons())
+    {
+        auto linked = this->gatesByButton->find(button->GetId());
+        if (linked != this->gatesByButton->end())
+        {
+            auto& orders = linked->second;
+            orders.erase(std::remove(orders.begin(), orders.end(), Order), orders.end());
+            if (orders.empty())
+                this->gatesByButton->erase(linked);
+        }
+
+        if (!this->InRange(button->GetPosition()))
+            continue;
+
+        int index = this->GetCellIndex(button->GetPosition());
+        auto entry = this->gatesByButtonCell->find(index);
+        auto& gates = entry->second;
+        gates.erase(std::find(gates.begin(), gates.end(), Order));
+        if (gates.empty())
+            this->gatesByButtonCell->erase(entry);
+        this->grid.GetMutable(index).GateCount--;
+    }
+    this->pressedButtons.GetMutable(Order) = 0;
+}
+
+/// \brief Adds the given delta to the pressed-button counts of
+/// all gates that watch the given cell.
+void Board::UpdateGates(int CellIndex, int Delta)
+{
+    for (int order : this->gatesByButtonCell->at(CellIndex))
+    {
+        auto& pressed = this->pressedButtons.GetMutable(order);
+        bool wasOpened = pressed > 0;
+        pressed += Delta;
+        if (wasOpened != (pressed > 0) && !this->observers.Items.empty())
+        {
+            // Gate events are held back until the board is consistent
+            // again.
+            auto& pending = this->observers.PendingGates;
+            auto isPending = [order](const std::pair<int, bool>& Item) { return Item.first == order; };
+            if (std::find_if(pending.begin(), pending.end(), isPending) == pending.end())
+                pending.push_back(std::make_pair(order, wasOpened));
+        }
+    }
+}
+
+/// \brief Sends a gate-toggled event for every gate whose state
+/// has been changed by the current operation.
+void Board::NotifyGates()
+{
+    for (auto& item : this->observers.PendingGates)
+    {
+        bool isOpened = this->pressedButtons[item.first] > 0;
+        auto& gate = this->gates.Items[item.first];
+        if (isOpened != item.second && gate != nullptr)
+            for (auto observer : this->observers.Items)
+                observer->GateToggled(*this, gate, isOpened);
+    }
+    this->observers.PendingGates.clear();
+}
+
+/// \brief Appends the given piece to the given list, and returns
+/// its index.
+template<typename T>
+int Board::Append(PieceList<T>& List, const std::shared_ptr<T>& Value)
+{
+    int result = List.Items.size();
+    List.Items.push_back(Value);
+    List.Count++;
     return result;
-}
\ No newline at end of file
+}
+
+/// \brief Replaces the piece at the given index in the given
+/// list by a tombstone.
+template<typename T>
+void Board::Erase(PieceList<T>& List, int Index)
+{
+    List.Items.GetMutable(Index) = nullptr;
+    List.Count--;
+}
+
+/// \brief Appends the given piece to the given per-type registry
+/// if it is of the registry's type. A boolean is returned that
+/// tells if this is the case.
+template<typename T>
+bool Board::AddToRegistry(PieceList<T>& Registry, const std::shared_ptr<PieceBase>& Value, Slot& Info)
+{
+    auto item = std::dynamic_pointer_cast<T>(Value);
+    if (item == nullptr)
+        return false;
+
+    Info.TypeOrder = Append(Registry, item);
+    return true;
+}
+
+/// \brief Removes the given piece from the given per-type
+/// registry if it is of the registry's type. A boolean is
+/// returned that tells if this is the case.
+template<typename T>
+bool Board::RemoveFromRegistry(PieceList<T>& Registry, const PieceBase& Value, const Slot& Info)
+{
+    if (dynamic_cast<const T*>(&Value) == nullptr)
+        return false;
+
+    Erase(Registry, Info.TypeOrder);
+    return true;
+}
+
+/// \brief Replaces the given piece's entry in the given per-type
+/// registry by the given copy, if the piece is of the
+/// registry's type. A boolean is returned that tells if this
+/// is the case.
+template<typename T>
+bool Board::ReplaceInRegistry(PieceList<T>& Registry, const std::shared_ptr<PieceBase>& Copy, const Slot& Info)
+{
+    auto item = std::dynamic_pointer_cast<T>(Copy);
+    if (item == nullptr)
+        return false;
+
+    Registry.Items.GetMutable(Info.TypeOrder) = item;
+    return true;
+}
+
+/// \brief Puts the given piece back in its tombstone in the given
+/// per-type registry, if it is of the registry's type. A
+/// boolean is returned that tells if this is the case.
+template<typename T>
+bool Board::RestoreToRegistry(PieceList<T>& Registry, const std::shared_ptr<PieceBase>& Value, const Slot& Info)
+{
+    auto item = std::dynamic_pointer_cast<T>(Value);
+    if (item == nullptr)
+        return false;
+
+    Registry.Items.GetMutable(Info.TypeOrder) = item;
+    Registry.Count++;
+    return true;
+}
+
+/// \brief Appends a piece to the piece list, and adds it to all
+/// of the board's indices.
+void Board::RegisterPiece(const std::shared_ptr<PieceBase>& Value)
+{
+    int slot = Append(this->pcs, Value);
+    Value->boardSlot = slot;
+    Value->boardFamily = this->family;
+    Slot info;
+    info.KindHash = GetKindHash(*Value);
+    info.Owner = this->ownerTag.Get();
+    this->IndexPiece(slot, *Value, Value->GetPosition());
+    this->stateHash ^= GetPieceHash(info.KindHash, Value->GetPosition());
+    auto actor = std::dynamic_pointer_cast<Actor>(Value);
+    if (actor != nullptr)
+    {
+        // The name index is shared with forks, so copy it before
+        // modifying it.
+        if (this->actorsByName.use_count() != 1)
+            this->actorsByName = std::make_shared<std::unordered_map<Symbol, std::vector<int>>>(*this->actorsByName);
+        (*this->actorsByName)[actor->GetName()].push_back(slot);
+    }
+
+    if (typeid(*Value) == typeid(Obstacle))
+        info.TypeOrder = Append(this->obstacles, std::static_pointer_cast<Obstacle>(Value));
+    else
+        AddToRegistry(this->players, Value, info) || 
+        AddToRegistry(this->monsters, Value, info) || 
+        AddToRegistry(this->goals, Value, info) || 
+        AddToRegistry(this->gates, Value, info) || 
+        AddToRegistry(this->buttons, Value, info) || 
+        AddToRegistry(this->traps, Value, info) || 
+        AddToRegistry(this->water, Value, info);
+    auto gate = std::dynamic_pointer_cast<Gate>(Value);
+    if (gate != nullptr)
+        this->BindGate(*gate, info.TypeOrder);
+    this->slots.push_back(info);
+}
+
+/// \brief Puts a removed piece back in its slot in the piece list,
+/// and adds it to all of the board's indices again.
+void Board::ReregisterPiece(const std::shared_ptr<PieceBase>& Value)
+{
+    // The slot's bookkeeping survives the removal. Its owner tag is
+    // still accurate too: forking a board hands out fresh tags, so a
+    // piece that may be shared with a fork is copied before it is
+    // modified, just as before it was removed.
+    int slot = Value->boardSlot;
+    auto info = this->slots[slot];
+    this->pcs.Items.GetMutable(slot) = Value;
+    this->pcs.Count++;
+    this->IndexPiece(slot, *Value, Value->GetPosition());
+    this->stateHash ^= GetPieceHash(info.KindHash, Value->GetPosition());
+    auto actor = std::dynamic_pointer_cast<Actor>(Value);
+    if (actor != nullptr)
+    {
+        if (this->actorsByName.use_count() != 1)
+            this->actorsByName = std::make_shared<std::unordered_map<Symbol, std::vector<int>>>(*this->actorsByName);
+        // A shared name index still lists the slot, because removals
+        // leave shared indices alone.
+        auto& actors = (*this->actorsByName)[actor->GetName()];
+        auto position = std::lower_bound(actors.begin(), actors.end(), slot);
+        if (position == actors.end() || *position != slot)
+            actors.insert(position, slot);
+    }
+
+    if (typeid(*Value) == typeid(Obstacle))
+        RestoreToRegistry(this->obstacles, Value, info);
+    else
+        RestoreToRegistry(this->players, Value, info) || 
+        RestoreToRegistry(this->monsters, Value, info) || 
+        RestoreToRegistry(this->goals, Value, info) || 
+        RestoreToRegistry(this->gates, Value, info) || 
+        RestoreToRegistry(this->buttons, Value, info) || 
+        RestoreToRegistry(this->traps, Value, info) || 
+        RestoreToRegistry(this->water, Value, info);
+    auto gate = std::dynamic_pointer_cast<Gate>(Value);
+    if (gate != nullptr)
+        this->BindGate(*gate, info.TypeOrder);
+}
+
+/// \brief Takes the piece in the given slot off the piece list,
+/// removes it from all of the board's indices, and returns it.
+std::shared_ptr<PieceBase> Board::UnregisterPiece(int Index)
+{
+    // Move the piece out of its slot instead of copying it: this
+    // leaves the tombstone behind without touching the reference
+    // count.
+    auto value = std::move(this->pcs.Items.GetMutable(Index));
+    auto info = this->slots[Index];
+    Erase(this->pcs, Index);
+    this->UnindexPiece(Index, *value, value->GetPosition());
+    this->stateHash ^= GetPieceHash(info.KindHash, value->GetPosition());
+    auto actor = dynamic_cast<const Actor*>(value.get());
+    if (actor != nullptr && this->actorsByName.use_count() == 1)
+    {
+        // Lookups skip removed slots, so a name index that is shared
+        // with forks is left alone rather than copied.
+        auto named = this->actorsByName->find(actor->GetName());
+        auto& actors = named->second;
+        actors.erase(std::find(actors.begin(), actors.end(), Index));
+        if (actors.empty())
+            this->actorsByName->erase(named);
+    }
+
+    if (typeid(*value) == typeid(Obstacle))
+        Erase(this->obstacles, info.TypeOrder);
+    else
+        RemoveFromRegistry(this->players, *value, info) || 
+        RemoveFromRegistry(this->monsters, *value, info) || 
+        RemoveFromRegistry(this->goals, *value, info) || 
+        RemoveFromRegistry(this->gates, *value, info) || 
+        RemoveFromRegistry(this->buttons, *value, info) || 
+        RemoveFromRegistry(this->traps, *value, info) || 
+        RemoveFromRegistry(this->water, *value, info);
+    auto gate = dynamic_cast<const Gate*>(value.get());
+    if (gate != nullptr)
+        this->UnbindGate(*gate, info.TypeOrder);
+    return value;
+}
+
+/// \brief Computes a hash of the given piece's type and
+/// movability.
+std::uint64_t Board::GetKindHash(const PieceBase& Value)
+{
+    // FNV-1a over the piece's dynamic type name.
+    std::uint64_t result = 14695981039346656037ull;
+    for (const char* c = typeid(Value).name(); *c != '\0'; c++)
+        result = (result ^ (unsigned char)*c) * 1099511628211ull;
+
+    return (result << 1) | (Value.GetMovable() ? 1u : 0u);
+}
+
+/// \brief Computes the contribution of a piece with the given
+/// kind hash at the given position to the state hash.
+std::uint64_t Board::GetPieceHash(std::uint64_t KindHash, Vector2<int> Position)
+{
+    // Mix the position into the kind hash, and scramble the result
+    // with the splitmix64 finalizer. Unlike a table of random keys,
+    // this works for boards of any size.
+    std::uint64_t result = KindHash ^ 
+        ((std::uint64_t)(std::uint32_t)Position.X << 32 | (std::uint32_t)Position.Y);
+    result += 0x9e3779b97f4a7c15ull;
+    result = (result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ull;
+    result = (result ^ (result >> 27)) * 0x94d049bb133111ebull;
+    return result ^ (result >> 31);
+}
+
+/// \brief Replaces the board's contents by the given pieces, and
+/// rebuilds all of the board's indices.
+void Board::RebuildIndex(const std::vector<std::shared_ptr<PieceBase>>& Pieces)
+{
+    this->pcs = PieceList<PieceBase>();
+    this->slots.clear();
+    this->stateHash = 0;
+    this->grid.clear();
+    for (int i = 0; i < this->Size_value.X * this->Size_value.Y; i++)
+        this->grid.push_back(Cell());
+    this->actorsByName = std::make_shared<std::unordered_map<Symbol, std::vector<int>>>();
+    this->players = PieceList<Player>();
+    this->monsters = PieceList<Monster>();
+    this->goals = PieceList<Goal>();
+    this->gates = PieceList<Gate>();
+    this->buttons = PieceList<Button>();
+    this->traps = PieceList<Trap>();
+    this->water = PieceList<Water>();
+    this->obstacles = PieceList<Obstacle>();
+    this->pressedButtons.clear();
+    this->gatesByButtonCell = std::make_shared<std::unordered_map<int, std::vector<int>>>();
+    this->gatesByButton = std::make_shared<std::unordered_map<int, std::vector<int>>>();
+    for (auto& p : Pieces)
+        this->RegisterPiece(p);
+}
+
+/// \brief Counts the owner tags that have been handed out.
+static std::atomic<unsigned> nextOwnerTag(0);
+
+/// \brief Creates a fresh owner tag.
+Board::OwnerTag::OwnerTag()
+    : Value(++nextOwnerTag)
+{ }
+
+/// \brief Creates a fresh owner tag for a copy of a board, and
+/// hands out a fresh tag to the original as well.
+Board::OwnerTag::OwnerTag(const OwnerTag& Other)
+    : Value(++nextOwnerTag)
+{
+    Other.Value.store(++nextOwnerTag, std::memory_order_relaxed);
+}
+
+/// \brief Takes over the given board's owner tag.
+Board::OwnerTag::OwnerTag(OwnerTag&& Other)
+    : Value(Other.Value.load(std::memory_order_relaxed))
+{
+    Other.Value.store(++nextOwnerTag, std::memory_order_relaxed);
+}
+
+/// \brief Hands out fresh owner tags to both a copy of a board
+/// and the original.
+Board::OwnerTag& Board::OwnerTag::operator=(const OwnerTag& Other)
+{
+    this->Value.store(++nextOwnerTag, std::memory_order_relaxed);
+    Other.Value.store(++nextOwnerTag, std::memory_order_relaxed);
+    return *this;
+}
+
+/// \brief Takes over the given board's owner tag.
+Board::OwnerTag& Board::OwnerTag::operator=(OwnerTag&& Other)
+{
+    this->Value.store(Other.Value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    Other.Value.store(++nextOwnerTag, std::memory_order_relaxed);
+    return *this;
+}
+
+/// \brief Gets the tag's value.
+unsigned Board::OwnerTag::Get() const
+{
+    return this->Value.load(std::memory_order_relaxed);
+}
@@ -1,144 +1,581 @@
 #pragma once
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include "Contracts.h"
+#include "CowVector.h"
+#include "IBoardObserver.h"
+#include "PieceArena.h"
+#include "PieceHandle.h"
+#include "PieceView.h"
+#include "Symbol.h"
 #include "Vector2.h"
 
 namespace Arcade
 {
     class Actor;
+    struct Button;
     class Collision;
+    class Gate;
+    struct Goal;
+    struct Monster;
+    class Obstacle;
     class PieceBase;
     struct Player;
+    struct Trap;
+    struct Water;
 
     /// \brief Describes a board in the game.
     class Board
     {
     public:
         /// \brief Creates a new board with the given name of the given size.
-        /// \pre require(Size.X > 0);
-        /// \pre require(Size.Y > 0);
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Size.X > 0);
+        /// \pre require_cheap(Size.Y > 0);
+        /// \post ensure_cheap(this->CheckInvariants());
         Board(std::string Name, Vector2<int> Size);
         /// \brief Creates a new board with the given name of the given size
         /// containing the given pieces.
-        /// \pre require(Size.X > 0);
-        /// \pre require(Size.Y > 0);
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Size.X > 0);
+        /// \pre require_cheap(Size.Y > 0);
+        /// \pre require_cheap(this->CanAddPiece(*p)), for every piece p in
+        /// Pieces.
+        /// \post ensure_cheap(this->CheckInvariants());
         Board(std::string Name, Vector2<int> Size, std::vector<std::shared_ptr<PieceBase>> Pieces);
+        /// \brief Creates a copy-on-write fork of the given board.
+        /// This takes constant time: the fork shares all of its
+        /// storage with the original board until either of them
+        /// is modified.
+        Board(const Board& Other) = default;
+        Board(Board&& Other) = default;
+
+        Board& operator=(const Board& Other) = default;
+        Board& operator=(Board&& Other) = default;
 
         /// \brief Adds a piece to the board.
-        /// \pre require(Value->GetIsTerrain() ||
+        /// \pre require_cheap(Value->GetIsTerrain() ||
         /// this->GetItem(Value->GetPosition()) == nullptr ||
         /// this->GetItem(Value->GetPosition())->GetIsTerrain());
-        /// \pre require(this->InRange(Value->GetPosition()));
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->InRange(Value->GetPosition()));
+        /// \pre require_cheap(this->CanAddPiece(*Value));
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void AddPiece(std::shared_ptr<PieceBase> Value);
 
+        /// \brief Gets a boolean value that tells if the given piece can be
+        /// added to this board. A piece belongs to the first board that it
+        /// is added to, and to that board's forks, even after it has been
+        /// removed, so it cannot be added to any other board.
+        bool CanAddPiece(const PieceBase& Value) const;
+
         /// \brief Checks if this type's invariants are being respected.
         /// A boolean value is returned that indicates whether this is
         /// indeed the case. This method is publically visible, and can
         /// be used to verify an instance's state.
+        /// \remark Boards may be read by several threads at once, so this
+        /// method reads fields directly instead of going through getters
+        /// that would check the invariants again.
         bool CheckInvariants() const;
         // {
-        //     if (!this->isCheckingInvariants)
-        //     {
-        //         this->isCheckingInvariants = true;
-        //         bool result = this->GetSize().X > 0 && this->GetSize().Y > 0;
-        //         this->isCheckingInvariants = false;
-        //         return result;
-        //     }
-        //     return true;
+        //     return this->Size_value.X > 0 && this->Size_value.Y > 0;
         // }
 
+        /// \brief Creates a copy-on-write fork of this board. Creating a
+        /// fork takes constant time, and the cost of modifying either
+        /// board afterwards is proportional to the number of pieces
+        /// that are modified, rather than to the size of the board.
+        /// Pieces are copied before they are first modified on either
+        /// board, so piece pointers that were obtained before the fork
+        /// may go stale. Use ResolvePiece to find a piece's current
+        /// counterpart on a board.
+        /// \remark Forking hands this board a fresh ownership tag, so
+        /// it copies its pieces before it next modifies them. Several
+        /// threads may fork a board, or read it, at the same time, as
+        /// long as no thread modifies it meanwhile.
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(result->GetStateHash() == this->GetStateHash());
+        std::shared_ptr<Board> Fork() const;
+
         /// \brief Gets the first actor with the given name.
-        /// \pre require(this->HasActor(Name));
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(result != nullptr);
-        /// \post ensure(this->InRange(result->GetPosition()));
+        /// \pre require_cheap(this->HasActor(Name));
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(result != nullptr);
+        /// \post ensure_cheap(this->InRange(result->GetPosition()));
         std::shared_ptr<Actor> GetActor(std::string Name) const;
 
         /// \brief Gets the first actor with the given name if they can be
         /// found. Otherwise, null.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(result == nullptr || this->InRange(result->GetPosition()));
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(result == nullptr || this->InRange(result->GetPosition()));
         std::shared_ptr<Actor> GetActorOrNull(std::string Name) const;
 
         /// \brief Gets the field's name.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
         std::string GetName() const;
 
+        /// \brief Gets a 64-bit hash of the board's state. The hash
+        /// covers every piece's type, position and movability, and
+        /// does not depend on the order in which pieces were added.
+        /// It is updated incrementally as pieces are added, removed
+        /// and moved.
+        /// \pre require_cheap(this->CheckInvariants());
+        std::uint64_t GetStateHash() const;
+
         /// \brief Gets all players on the board.
-        /// \pre require(this->CheckInvariants());
-        std::vector<std::shared_ptr<Player>> GetPlayers() const;
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceView<Player> GetPlayers() const;
+
+        /// \brief Gets all monsters on the board.
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceView<Monster> GetMonsters() const;
+
+        /// \brief Gets all goals on the board.
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceView<Goal> GetGoals() const;
+
+        /// \brief Gets all gates on the board.
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceView<Gate> GetGates() const;
+
+        /// \brief Gets all buttons on the board.
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceView<Button> GetButtons() const;
+
+        /// \brief Gets all traps on the board.
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceView<Trap> GetTraps() const;
+
+        /// \brief Gets all water pieces on the board.
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceView<Water> GetWater() const;
+
+        /// \brief Gets all plain obstacles, i.e. walls and barrels, on the
+        /// board.
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceView<Obstacle> GetObstacles() const;
+
+        /// \brief Gets the arena that this board's pieces can be
+        /// allocated from. Allocating all of a board's pieces in its
+        /// arena keeps them close together in memory. The arena is
+        /// shared with the board's forks.
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(result != nullptr);
+        std::shared_ptr<PieceArena> GetArena() const;
+
+        /// \brief Gets the first gate on this board that has the given
+        /// button as one of its associated buttons, if any. Otherwise,
+        /// null. This takes constant time.
+        /// \pre require_cheap(this->CheckInvariants());
+        std::shared_ptr<Gate> GetAssociatedGate(const Button& Value) const;
+
+        /// \brief Gets the number of the given gate's associated buttons
+        /// that are currently pressed, i.e. that share their position
+        /// with a non-terrain piece. This count is kept up to date as
+        /// pieces move, so reading it takes constant time. If the gate
+        /// is not on this board, -1 is returned.
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(result >= -1);
+        int GetPressedButtonCount(const Gate& Value) const;
 
         /// \brief Gets the board's dimensions.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(result.X > 0);
-        /// \post ensure(result.Y > 0);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(result.X > 0);
+        /// \post ensure_cheap(result.Y > 0);
         Vector2<int> GetSize() const;
 
         /// \brief Gets a boolean value that tells if this board contains the
         /// given actor.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
         bool HasActor(std::string Name) const;
 
         /// \brief Gets a boolean value that tells if this board contains the
         /// given piece.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
         bool HasPiece(std::shared_ptr<PieceBase> Value) const;
 
+        /// \brief Gets a boolean value that tells if the piece that the
+        /// given handle refers to is on this board.
+        /// \pre require_cheap(this->CheckInvariants());
+        bool HasPiece(PieceHandle Value) const;
+
+        /// \brief Gets a handle to the given piece. If the piece is not
+        /// on this board, an invalid handle is returned.
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(!result.IsValid() || this->HasPiece(result));
+        PieceHandle GetHandle(const PieceBase& Value) const;
+
+        /// \brief Gets the piece that the given handle refers to, or null
+        /// if that piece is not on this board. The board keeps
+        /// ownership of the piece: the pointer is invalidated when
+        /// the piece is moved or removed.
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceBase* GetPiece(PieceHandle Value) const;
+
         /// \brief Gets a boolean value that indicates whether the given
         /// point is in the board or not.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
         bool InRange(Vector2<int> Point) const;
 
+        /// \brief Gets this board's counterpart of the given piece, i.e.
+        /// the piece on this board that has the same identifier. If
+        /// there is no such piece, null is returned.
+        /// \pre require_cheap(Value != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(result == nullptr || result->GetId() == Value->GetId());
+        std::shared_ptr<PieceBase> ResolvePiece(std::shared_ptr<PieceBase> Value) const;
+
+        /// \brief Gets this board's counterpart of the given actor, i.e.
+        /// the actor on this board that has the same identifier. If
+        /// there is no such actor, null is returned.
+        /// \pre require_cheap(Value != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        std::shared_ptr<Actor> ResolveActor(std::shared_ptr<Actor> Value) const;
+
+        /// \brief Subscribes the given observer to this board's change
+        /// events. The board does not own its observers, so an observer
+        /// must unsubscribe before it is destroyed. Forks of a board do
+        /// not inherit its observers.
+        /// \pre require_cheap(Observer != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        void Subscribe(IBoardObserver* Observer);
+
+        /// \brief Unsubscribes the given observer from this board's
+        /// change events, and returns a boolean that tells if the
+        /// observer was subscribed.
+        /// \pre require_cheap(this->CheckInvariants());
+        bool Unsubscribe(IBoardObserver* Observer);
+
         /// \brief Removes a piece from the board, and returns a boolean that
         /// tells if the piece has been removed.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(!this->HasPiece(Value));
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(!this->HasPiece(Value));
+        /// \post ensure_cheap(this->CheckInvariants());
         bool RemovePiece(std::shared_ptr<PieceBase> Value);
 
+        /// \brief Removes the piece that the given handle refers to from
+        /// the board, and returns a boolean that tells if the piece has
+        /// been removed. If the board held the last reference to the
+        /// piece, the piece is destroyed, so a piece that removes
+        /// itself must not access its own state afterwards.
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(!this->HasPiece(Value));
+        /// \post ensure_cheap(this->CheckInvariants());
+        bool RemovePiece(PieceHandle Value);
+
+        /// \brief Gets a boolean value that tells if the given piece has
+        /// been removed from this board, and can be put back in the
+        /// slot that it was removed from.
+        /// \pre require_cheap(this->CheckInvariants());
+        bool CanRestorePiece(const PieceBase& Value) const;
+
+        /// \brief Puts a piece that has been removed from this board back
+        /// in the slot that it was removed from, so handles to the
+        /// piece become valid again. This undoes a removal.
+        /// \pre require_cheap(Value != nullptr);
+        /// \pre require_cheap(this->CanRestorePiece(*Value));
+        /// \pre require_cheap(Value->GetIsTerrain() ||
+        /// this->GetItem(Value->GetPosition()) == nullptr ||
+        /// this->GetItem(Value->GetPosition())->GetIsTerrain());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->HasPiece(Value));
+        /// \post ensure_cheap(this->CheckInvariants());
+        void RestorePiece(std::shared_ptr<PieceBase> Value);
+
         /// \brief Gets the board's height.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(result > 0);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(result > 0);
         int GetHeight() const;
 
         /// \brief Find the piece at the given coordinates.
         /// If no piece is found, return null.
         /// If the given position contains one or more terrain pieces
         /// and one other piece, the latter is returned.
-        /// \pre require(this->InRange(pos));
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->InRange(pos));
+        /// \pre require_cheap(this->CheckInvariants());
         std::shared_ptr<PieceBase> GetItem(Vector2<int> pos) const;
 
+        /// \brief Gets a handle to the piece at the given coordinates,
+        /// i.e. the piece that GetItem returns. If no piece is found,
+        /// an invalid handle is returned.
+        /// \pre require_cheap(this->InRange(pos));
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceHandle GetItemHandle(Vector2<int> pos) const;
+
         /// \brief Find the piece at the given coordinates.
         /// If no piece is found, return null.
-        /// \pre require(this->InRange(Vector2<int>(X, Y)));
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->InRange(Vector2<int>(X, Y)));
+        /// \pre require_cheap(this->CheckInvariants());
         std::shared_ptr<PieceBase> GetItem(int X, int Y) const;
 
-        /// \brief Gets all pieces on the board.
-        /// \pre require(this->CheckInvariants());
-        std::vector<std::shared_ptr<PieceBase>> GetPieces() const;
+        /// \brief Gets a view of all pieces on the board, in the order
+        /// in which they were added. The view does not copy the
+        /// board's pieces, and is invalidated when the board is
+        /// modified.
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceView<PieceBase> GetPieces() const;
 
         /// \brief Gets the board's width.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(result > 0);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(result > 0);
         int GetWidth() const;
+
+        /// \brief Moves the given piece to the given target position, and
+        /// updates the board's spatial index accordingly.
+        /// If the piece is shared with a fork of this board, then this
+        /// board's counterpart of the piece is copied before it is
+        /// moved. Pieces that are not on this board are moved as well,
+        /// but are not indexed.
+        /// \pre require_cheap(Value != nullptr);
+        /// \pre require_cheap(this->InRange(Target));
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap((this->HasPiece(Value) ? this->ResolvePiece(Value) : Value)->GetPosition() == Target);
+        /// \post ensure_cheap(this->CheckInvariants());
+        void MovePiece(std::shared_ptr<PieceBase> Value, Vector2<int> Target);
+
+        /// \brief Moves the piece that the given handle refers to to the
+        /// given target position, and updates the board's spatial index
+        /// accordingly. If the piece is shared with a fork of this
+        /// board, it is copied before it is moved.
+        /// \pre require_cheap(this->HasPiece(Value));
+        /// \pre require_cheap(this->InRange(Target));
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->GetPiece(Value)->GetPosition() == Target);
+        /// \post ensure_cheap(this->CheckInvariants());
+        void MovePiece(PieceHandle Value, Vector2<int> Target);
     private:
+        /// \brief Describes a single cell in the board's spatial index.
+        /// Every cell has one occupant slot and one terrain slot, which
+        /// hold piece slot indices.
+        struct Cell
+        {
+            /// \brief The slot of the first non-terrain piece at this
+            /// position, or -1.
+            int Occupant = -1;
+            /// \brief The slot of the last terrain piece at this
+            /// position, or -1.
+            int Terrain = -1;
+            /// \brief The number of non-terrain pieces at this position.
+            int OccupantCount = 0;
+            /// \brief The number of terrain pieces at this position.
+            int TerrainCount = 0;
+            /// \brief The number of gates that have an associated button
+            /// at this position.
+            int GateCount = 0;
+        };
+
+        /// \brief Describes the bookkeeping for a single piece slot.
+        struct Slot
+        {
+            /// \brief A hash of the piece's type and movability.
+            std::uint64_t KindHash = 0;
+            /// \brief The piece's index in its per-type registry, if any.
+            int TypeOrder = -1;
+            /// \brief The tag of the board that may modify the piece in
+            /// place. Any other board must copy it first.
+            unsigned Owner = 0;
+        };
+
+        /// \brief A list of pieces, in the order in which they were
+        /// added. Removing a piece leaves a null tombstone behind, so
+        /// indices into the list are stable, and are shared between a
+        /// board and its forks.
+        template<typename T>
+        struct PieceList
+        {
+            stdx::CowVector<std::shared_ptr<T>> Items;
+            /// \brief The number of pieces that have not been removed.
+            int Count = 0;
+        };
+
+        /// \brief A tag that identifies a board for the purpose of piece
+        /// ownership. Copying a tag hands out fresh tags to both the
+        /// copy and the original, so neither of them owns the pieces
+        /// they now share. The original's tag is atomic, so that
+        /// several threads can fork the same board at once.
+        struct OwnerTag
+        {
+            OwnerTag();
+            OwnerTag(const OwnerTag& Other);
+            OwnerTag(OwnerTag&& Other);
+            OwnerTag& operator=(const OwnerTag& Other);
+            OwnerTag& operator=(OwnerTag&& Other);
+
+            /// \brief Gets the tag's value.
+            unsigned Get() const;
+
+            mutable std::atomic<unsigned> Value;
+        };
+
+        /// \brief A list of observers. Copies of a board start out without
+        /// any observers, so copying an observer list yields an empty
+        /// list.
+        struct ObserverList
+        {
+            ObserverList() { }
+            // Copies deliberately leave the other list's observers behind.
+            ObserverList(const ObserverList&) { }
+            ObserverList(ObserverList&& Other) = default;
+            ObserverList& operator=(const ObserverList&) { return *this; }
+            ObserverList& operator=(ObserverList&& Other) = default;
+
+            std::vector<IBoardObserver*> Items;
+            /// \brief The registry indices of the gates that have been
+            /// toggled by the current operation, paired with their
+            /// state before the operation.
+            std::vector<std::pair<int, bool>> PendingGates;
+        };
+
+        /// \brief Sends a gate-toggled event for every gate whose state
+        /// has been changed by the current operation.
+        void NotifyGates();
+
+        /// \brief Gets the index of the given position in the spatial index.
+        int GetCellIndex(Vector2<int> Position) const;
+
+        /// \brief Gets the slot of the given piece on this board, or -1
+        /// if the piece is not on this board.
+        int GetSlot(const PieceBase& Value) const;
+
+        /// \brief Gets the piece in the given slot, and makes sure that
+        /// it is owned by this board by copying it if necessary.
+        PieceBase* GetWritablePiece(int Index);
+
+        /// \brief Adds the piece in the given slot to the spatial index,
+        /// at the given position.
+        void IndexPiece(int Index, const PieceBase& Value, Vector2<int> Position);
+
+        /// \brief Removes the piece in the given slot from the spatial
+        /// index, at the given position.
+        void UnindexPiece(int Index, const PieceBase& Value, Vector2<int> Position);
+
+        /// \brief Rebuilds one of the given cell's slots from the piece
+        /// list. This is only necessary when more than one piece of
+        /// the same kind shares a cell.
+        void RescanCell(Cell& Target, Vector2<int> Position, bool Terrain);
+
+        /// \brief Makes the gate with the given registry index watch the
+        /// positions of its associated buttons, counts the buttons that
+        /// are currently pressed, and links the buttons back to the
+        /// gate.
+        void BindGate(const Gate& Value, int Order);
+
+        /// \brief Makes the gate with the given registry index stop
+        /// watching the positions of its associated buttons, and
+        /// unlinks the buttons from the gate.
+        void UnbindGate(const Gate& Value, int Order);
+
+        /// \brief Adds the given delta to the pressed-button counts of
+        /// all gates that watch the given cell.
+        void UpdateGates(int CellIndex, int Delta);
+
+        /// \brief Appends the given piece to the given list, and returns
+        /// its index.
+        template<typename T>
+        static int Append(PieceList<T>& List, const std::shared_ptr<T>& Value);
+
+        /// \brief Replaces the piece at the given index in the given
+        /// list by a tombstone.
+        template<typename T>
+        static void Erase(PieceList<T>& List, int Index);
+
+        /// \brief Appends the given piece to the given per-type registry
+        /// if it is of the registry's type. A boolean is returned that
+        /// tells if this is the case.
+        template<typename T>
+        static bool AddToRegistry(PieceList<T>& Registry, const std::shared_ptr<PieceBase>& Value, Slot& Info);
+
+        /// \brief Removes the given piece from the given per-type
+        /// registry if it is of the registry's type. A boolean is
+        /// returned that tells if this is the case.
+        template<typename T>
+        static bool RemoveFromRegistry(PieceList<T>& Registry, const PieceBase& Value, const Slot& Info);
+
+        /// \brief Replaces the given piece's entry in the given per-type
+        /// registry by the given copy, if the piece is of the
+        /// registry's type. A boolean is returned that tells if this
+        /// is the case.
+        template<typename T>
+        static bool ReplaceInRegistry(PieceList<T>& Registry, const std::shared_ptr<PieceBase>& Copy, const Slot& Info);
+
+        /// \brief Puts the given piece back in its tombstone in the given
+        /// per-type registry, if it is of the registry's type. A
+        /// boolean is returned that tells if this is the case.
+        template<typename T>
+        static bool RestoreToRegistry(PieceList<T>& Registry, const std::shared_ptr<PieceBase>& Value, const Slot& Info);
+
+        /// \brief Appends a piece to the piece list, and adds it to all
+        /// of the board's indices.
+        void RegisterPiece(const std::shared_ptr<PieceBase>& Value);
+
+        /// \brief Puts a removed piece back in its slot in the piece list,
+        /// and adds it to all of the board's indices again.
+        void ReregisterPiece(const std::shared_ptr<PieceBase>& Value);
+
+        /// \brief Takes the piece in the given slot off the piece list,
+        /// removes it from all of the board's indices, and returns it.
+        std::shared_ptr<PieceBase> UnregisterPiece(int Index);
+
+        /// \brief Computes a hash of the given piece's type and
+        /// movability.
+        static std::uint64_t GetKindHash(const PieceBase& Value);
+
+        /// \brief Computes the contribution of a piece with the given
+        /// kind hash at the given position to the state hash.
+        static std::uint64_t GetPieceHash(std::uint64_t KindHash, Vector2<int> Position);
+
+        /// \brief Replaces the board's contents by the given pieces, and
+        /// rebuilds all of the board's indices.
+        void RebuildIndex(const std::vector<std::shared_ptr<PieceBase>>& Pieces);
+
         /// \brief Sets the field's name.
         void SetName(std::string value);
 
         /// \brief Sets the board's dimensions.
         void SetSize(Vector2<int> value);
 
-        mutable bool isCheckingInvariants = false;
         std::string Name_value;
-        std::vector<std::shared_ptr<PieceBase>> pcs;
+        std::shared_ptr<PieceArena> arena;
+        /// \brief All pieces on the board, indexed by slot.
+        PieceList<PieceBase> pcs;
+        /// \brief The bookkeeping for every slot in the piece list.
+        stdx::CowVector<Slot> slots;
+        stdx::CowVector<Cell> grid;
+        /// \brief The exclusive or of all pieces' hashes.
+        std::uint64_t stateHash = 0;
+        /// \brief Maps actor names to the slots of the actors with that
+        /// name, in slot order. This map is shared with forks until it
+        /// is modified. Slots of actors that have been removed from a
+        /// board with forks are only skipped, not erased.
+        std::shared_ptr<std::unordered_map<Symbol, std::vector<int>>> actorsByName;
+        /// \brief Per-type piece registries, in piece-list order.
+        PieceList<Player> players;
+        PieceList<Monster> monsters;
+        PieceList<Goal> goals;
+        PieceList<Gate> gates;
+        PieceList<Button> buttons;
+        PieceList<Trap> traps;
+        PieceList<Water> water;
+        PieceList<Obstacle> obstacles;
+        /// \brief The number of pressed associated buttons of every gate,
+        /// in gate registry order.
+        stdx::CowVector<int> pressedButtons;
+        /// \brief Maps cell indices to the registry indices of the gates
+        /// that have an associated button in that cell. This map is
+        /// shared with forks until it is modified.
+        std::shared_ptr<std::unordered_map<int, std::vector<int>>> gatesByButtonCell;
+        /// \brief Maps button identifiers to the registry indices of the
+        /// gates that the buttons are associated with, in registry
+        /// order. This map is shared with forks until it is modified.
+        std::shared_ptr<std::unordered_map<int, std::vector<int>>> gatesByButton;
+        OwnerTag ownerTag;
+        /// \brief Identifies this board and its forks, which share the
+        /// slots of their pieces.
+        unsigned family;
+        ObserverList observers;
         Vector2<int> Size_value;
     };
 }
\ No newline at end of file
@@ -0,0 +1,246 @@
+#include "BoardJournal.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Board.h"
+#include "Contracts.h"
+#include "Gate.h"
+#include "IBoardObserver.h"
+#include "ICommand.h"
+#include "PieceBase.h"
+#include "PieceHandle.h"
+#include "Vector2.h"
+
+using namespace Arcade;
+
+/// \brief Creates an empty journal for the given board.
+/// \pre require_cheap(Scene != nullptr);
+/// \post ensure_cheap(this->CheckInvariants());
+BoardJournal::BoardJournal(std::shared_ptr<Board> Scene)
+    : scene(Scene)
+{
+    require_cheap(Scene != nullptr);
+    this->scene->Subscribe(this);
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Stops watching the journal's board.
+BoardJournal::~BoardJournal()
+{
+    this->scene->Unsubscribe(this);
+}
+
+/// \brief Checks if this type's invariants are being respected.
+/// A boolean value is returned that indicates whether this is
+/// indeed the case. This method is publically visible, and can
+/// be used to verify an instance's state.
+bool BoardJournal::CheckInvariants() const
+{
+    if (!this->isCheckingInvariants)
+    {
+        this->isCheckingInvariants = true;
+        bool result = this->scene != nullptr &&
+                      !(this->isRecording && this->isReplaying);
+        this->isCheckingInvariants = false;
+        return result;
+    }
+    return true;
+}
+
+/// \brief Executes the given command on the journal's board, and
+/// records the changes that it makes as a new entry. Entries
+/// that could be redone are discarded. A command that does not
+/// change the board is not recorded. The command's result is
+/// returned.
+/// \pre require_cheap(Command != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
+bool BoardJournal::Execute(std::shared_ptr<ICommand<std::shared_ptr<Board>>> Command)
+{
+    require_cheap(Command != nullptr);
+    require_cheap(this->CheckInvariants());
+    this->pending.clear();
+    this->isRecording = true;
+    bool result;
+    try
+    {
+        result = Command->Execute(this->scene);
+    }
+    catch (...)
+    {
+        this->isRecording = false;
+        this->Clear();
+        throw;
+    }
+    this->isRecording = false;
+
+    if (!this->pending.empty())
+    {
+        this->undoEntries.push_back(std::move(this->pending));
+        this->redoEntries.clear();
+    }
+    this->pending.clear();
+    ensure_cheap(this->CheckInvariants());
+    return result;
+}
+
+/// \brief Undoes the most recent entry, and returns a boolean that
+/// tells if there was an entry to undo.
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
+bool BoardJournal::Undo()
+{
+    require_cheap(this->CheckInvariants());
+    if (this->undoEntries.empty())
+        return false;
+
+    auto entry = std::move(this->undoEntries.back());
+    this->undoEntries.pop_back();
+    this->isReplaying = true;
+    for (auto change = entry.rbegin(); change != entry.rend(); ++change)
+        this->Revert(*change);
+    this->isReplaying = false;
+    this->redoEntries.push_back(std::move(entry));
+    ensure_cheap(this->CheckInvariants());
+    return true;
+}
+
+/// \brief Redoes the most recently undone entry, and returns a
+/// boolean that tells if there was an entry to redo.
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
+bool BoardJournal::Redo()
+{
+    require_cheap(this->CheckInvariants());
+    if (this->redoEntries.empty())
+        return false;
+
+    auto entry = std::move(this->redoEntries.back());
+    this->redoEntries.pop_back();
+    this->isReplaying = true;
+    for (auto& change : entry)
+        this->Reapply(change);
+    this->isReplaying = false;
+    this->undoEntries.push_back(std::move(entry));
+    ensure_cheap(this->CheckInvariants());
+    return true;
+}
+
+/// \brief Discards all entries.
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->GetUndoCount() == 0);
+/// \post ensure_cheap(this->GetRedoCount() == 0);
+void BoardJournal::Clear()
+{
+    require_cheap(this->CheckInvariants());
+    this->undoEntries.clear();
+    this->redoEntries.clear();
+    ensure_cheap(this->GetUndoCount() == 0);
+    ensure_cheap(this->GetRedoCount() == 0);
+}
+
+/// \brief Gets the number of entries that can be undone.
+/// \pre require_cheap(this->CheckInvariants());
+int BoardJournal::GetUndoCount() const
+{
+    require_cheap(this->CheckInvariants());
+    return (int)this->undoEntries.size();
+}
+
+/// \brief Gets the number of entries that can be redone.
+/// \pre require_cheap(this->CheckInvariants());
+int BoardJournal::GetRedoCount() const
+{
+    require_cheap(this->CheckInvariants());
+    return (int)this->redoEntries.size();
+}
+
+/// \brief Gets the board that this journal records changes to.
+/// \pre require_cheap(this->CheckInvariants());
+std::shared_ptr<Board> BoardJournal::GetScene() const
+{
+    require_cheap(this->CheckInvariants());
+    return this->scene;
+}
+
+/// \brief Records that the given piece has been added.
+void BoardJournal::PieceAdded(const Board& /*Scene*/, const std::shared_ptr<PieceBase>& Piece)
+{
+    Change change;
+    change.Kind = ChangeKind::Added;
+    change.Piece = Piece;
+    this->Record(change);
+}
+
+/// \brief Records that the given piece has been removed.
+void BoardJournal::PieceRemoved(const Board& /*Scene*/, const std::shared_ptr<PieceBase>& Piece)
+{
+    Change change;
+    change.Kind = ChangeKind::Removed;
+    change.Piece = Piece;
+    this->Record(change);
+}
+
+/// \brief Records that the given piece has moved.
+void BoardJournal::PieceMoved(const Board& Scene, const std::shared_ptr<PieceBase>& Piece, Vector2<int> Source, Vector2<int> Target)
+{
+    Change change;
+    change.Kind = ChangeKind::Moved;
+    change.Handle = Scene.GetHandle(*Piece);
+    change.Source = Source;
+    change.Target = Target;
+    this->Record(change);
+}
+
+/// \brief Does nothing: gates follow from the positions of the
+/// pieces on their buttons.
+void BoardJournal::GateToggled(const Board& /*Scene*/, const std::shared_ptr<Gate>& /*Piece*/, bool /*IsOpened*/)
+{ }
+
+/// \brief Records the given change, or clears the journal if no
+/// command is being recorded.
+void BoardJournal::Record(const Change& Value)
+{
+    if (this->isReplaying)
+        return;
+
+    if (this->isRecording)
+        this->pending.push_back(Value);
+    else
+        this->Clear();
+}
+
+/// \brief Undoes the given change.
+void BoardJournal::Revert(const Change& Value)
+{
+    switch (Value.Kind)
+    {
+    case ChangeKind::Added:
+        this->scene->RemovePiece(this->scene->GetHandle(*Value.Piece));
+        break;
+    case ChangeKind::Removed:
+        this->scene->RestorePiece(Value.Piece);
+        break;
+    case ChangeKind::Moved:
+        this->scene->MovePiece(Value.Handle, Value.Source);
+        break;
+    }
+}
+
+/// \brief Redoes the given change.
+void BoardJournal::Reapply(const Change& Value)
+{
+    switch (Value.Kind)
+    {
+    case ChangeKind::Added:
+        this->scene->RestorePiece(Value.Piece);
+        break;
+    case ChangeKind::Removed:
+        this->scene->RemovePiece(this->scene->GetHandle(*Value.Piece));
+        break;
+    case ChangeKind::Moved:
+        this->scene->MovePiece(Value.Handle, Value.Target);
+        break;
+    }
+}
@@ -0,0 +1,138 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "Board.h"
+#include "Contracts.h"
+#include "IBoardObserver.h"
+#include "ICommand.h"
+#include "PieceHandle.h"
+#include "Vector2.h"
+
+namespace Arcade
+{
+    /// \brief Describes a board observer that records the changes that
+    /// commands make to a board, so that they can be undone and
+    /// redone. Every entry in the journal holds the changes of a
+    /// single command: the pieces that it moved, along with their
+    /// source and target positions, and the pieces that it added or
+    /// removed. Undoing or redoing an entry only touches those
+    /// pieces. Removed pieces are put back in the slots that they
+    /// were removed from, so handles to them stay valid.
+    /// \remark A change to the board that the journal did not record
+    /// clears the journal, because its entries no longer apply.
+    class BoardJournal : public IBoardObserver
+    {
+    public:
+        /// \brief Creates an empty journal for the given board.
+        /// \pre require_cheap(Scene != nullptr);
+        /// \post ensure_cheap(this->CheckInvariants());
+        BoardJournal(std::shared_ptr<Board> Scene);
+
+        /// \brief Stops watching the journal's board.
+        ~BoardJournal();
+
+        BoardJournal(const BoardJournal& Other) = delete;
+        BoardJournal& operator=(const BoardJournal& Other) = delete;
+
+        /// \brief Checks if this type's invariants are being respected.
+        /// A boolean value is returned that indicates whether this is
+        /// indeed the case. This method is publically visible, and can
+        /// be used to verify an instance's state.
+        bool CheckInvariants() const;
+
+        /// \brief Executes the given command on the journal's board, and
+        /// records the changes that it makes as a new entry. Entries
+        /// that could be redone are discarded. A command that does not
+        /// change the board is not recorded. The command's result is
+        /// returned.
+        /// \pre require_cheap(Command != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
+        bool Execute(std::shared_ptr<ICommand<std::shared_ptr<Board>>> Command);
+
+        /// \brief Undoes the most recent entry, and returns a boolean that
+        /// tells if there was an entry to undo.
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
+        bool Undo();
+
+        /// \brief Redoes the most recently undone entry, and returns a
+        /// boolean that tells if there was an entry to redo.
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
+        bool Redo();
+
+        /// \brief Discards all entries.
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->GetUndoCount() == 0);
+        /// \post ensure_cheap(this->GetRedoCount() == 0);
+        void Clear();
+
+        /// \brief Gets the number of entries that can be undone.
+        /// \pre require_cheap(this->CheckInvariants());
+        int GetUndoCount() const;
+
+        /// \brief Gets the number of entries that can be redone.
+        /// \pre require_cheap(this->CheckInvariants());
+        int GetRedoCount() const;
+
+        /// \brief Gets the board that this journal records changes to.
+        /// \pre require_cheap(this->CheckInvariants());
+        std::shared_ptr<Board> GetScene() const;
+
+        /// \brief Records that the given piece has been added.
+        void PieceAdded(const Board& Scene, const std::shared_ptr<PieceBase>& Piece) override;
+
+        /// \brief Records that the given piece has been removed.
+        void PieceRemoved(const Board& Scene, const std::shared_ptr<PieceBase>& Piece) override;
+
+        /// \brief Records that the given piece has moved.
+        void PieceMoved(const Board& Scene, const std::shared_ptr<PieceBase>& Piece, Vector2<int> Source, Vector2<int> Target) override;
+
+        /// \brief Does nothing: gates follow from the positions of the
+        /// pieces on their buttons.
+        void GateToggled(const Board& Scene, const std::shared_ptr<Gate>& Piece, bool IsOpened) override;
+    private:
+        /// \brief Enumerates the kinds of changes to a board.
+        enum class ChangeKind
+        {
+            Added,
+            Removed,
+            Moved
+        };
+
+        /// \brief Describes a single change to a board.
+        struct Change
+        {
+            ChangeKind Kind;
+            /// \brief The piece that has been added or removed. Moved
+            /// pieces are referred to by handle instead, because the
+            /// board may copy them when they move.
+            std::shared_ptr<PieceBase> Piece;
+            PieceHandle Handle;
+            Vector2<int> Source;
+            Vector2<int> Target;
+        };
+
+        /// \brief Records the given change, or clears the journal if no
+        /// command is being recorded.
+        void Record(const Change& Value);
+
+        /// \brief Undoes the given change.
+        void Revert(const Change& Value);
+
+        /// \brief Redoes the given change.
+        void Reapply(const Change& Value);
+
+        mutable bool isCheckingInvariants = false;
+        /// \brief Tells if a command is being executed.
+        bool isRecording = false;
+        /// \brief Tells if an entry is being undone or redone.
+        bool isReplaying = false;
+        std::shared_ptr<Board> scene;
+        std::vector<std::vector<Change>> undoEntries;
+        std::vector<std::vector<Change>> redoEntries;
+        /// \brief The changes of the command that is being executed.
+        std::vector<Change> pending;
+    };
+}
@@ -21,14 +21,21 @@ Button::Button(Vector2<int> Position)
     this->SetMovable(false);
 }
 
+/// \brief Creates a copy of this piece that shares its
+/// identifier.
+std::shared_ptr<PieceBase> Button::Clone() const
+{
+    return std::make_shared<Button>(*this);
+}
+
 /// \brief Has a piece collide with this piece.
 /// A boolean is returned that indicates whether another piece
 /// is free to move onto this piece's (previous) position or
 /// not.
-/// \pre require(Event.GetStaticPiece().get() == this);
+/// \pre require(Event.GetStaticPiece() == this);
 bool Button::Collide(Collision Event)
 {
-    require(Event.GetStaticPiece().get() == this);
+    require(Event.GetStaticPiece() == this);
     return true;
 }
 
@@ -38,15 +45,7 @@ bool Button::Collide(Collision Event)
 std::shared_ptr<Gate> Button::GetAssociatedGate(std::shared_ptr<Board> Scene) const
 {
     require(Scene != nullptr);
-    for (auto& item : Scene->GetPieces())
-        if (stdx::isinstance<Gate>(item))
-        {
-            auto gate = std::dynamic_pointer_cast<Gate>(item);
-            if (gate->IsAssociatedButton(this))
-                return gate;
-
-        }
-    return nullptr;
+    return Scene->GetAssociatedGate(*this);
 }
 
 /// \brief Gets this button's associated gate's name.
@@ -23,86 +23,86 @@ using namespace Arcade;
 
 /// \brief Creates a new CG UI handler that outputs to the given
 /// output stream.
-/// \pre require(outputStream != nullptr);
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(outputStream != nullptr);
+/// \post ensure_cheap(this->CheckInvariants());
 CGUIHandler::CGUIHandler(std::ostream* outputStream)
     : PieceUIHandlerBase(outputStream), NrFigures(0)
 {
-    require(outputStream != nullptr);
-    ensure(this->CheckInvariants());
+    require_cheap(outputStream != nullptr);
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Applies a command to the board.
-/// \pre require(Command != nullptr);
-/// \pre require(this->GetIsInitialized());
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Command != nullptr);
+/// \pre require_cheap(this->GetIsInitialized());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::Apply(std::shared_ptr<ICommand<std::shared_ptr<Board>>> Command)
 {
-    require(Command != nullptr);
-    require(this->GetIsInitialized());
-    require(this->CheckInvariants());
+    require_cheap(Command != nullptr);
+    require_cheap(this->GetIsInitialized());
+    require_cheap(this->CheckInvariants());
     Command->Execute(this->board);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given barrel piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayBarrel(std::shared_ptr<Obstacle> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->WriteFigure(Piece, -0.5, "Cylinder", 0.7, 0.4, 0.1, 
                       0.96);
     this->WriteFloor(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a button piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayButton(std::shared_ptr<Button> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->WriteFigure(Piece, -0.5, "Cylinder", 0.7, 0.7, 0.1, 
                       0.2);
     this->WriteFloor(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays an unknown piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayDefault(std::shared_ptr<PieceBase> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->WriteFigure(Piece, 0.0, "Cube", 1.0, 1.0, 1.0, 0.96);
     this->WriteFloor(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays an empty cell.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayEmpty(Vector2<int> Position)
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     this->WriteFloor(Position);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a footer.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayFooter()
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     *this->outputStream << "[General]\n";
     *this->outputStream << "size = 1024\n";
     *this->outputStream << "shadowMask = 1024\n";
@@ -119,17 +119,17 @@ void CGUIHandler::DisplayFooter()
     *this->outputStream << "ambientLight = (1, 1, 1)\n";
     *this->outputStream << "diffuseLight = (1, 1, 1)\n";
     *this->outputStream << "specularLight = (1, 1, 1)\n";
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a goal piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayGate(std::shared_ptr<Gate> Piece, bool IsOpened)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     if (!IsOpened)
     {
         this->WriteFigure(Piece, -0.15, "Cube", 0.0, 0.6, 0.6, 0.96);
@@ -139,105 +139,105 @@ void CGUIHandler::DisplayGate(std::shared_ptr<Gate> Piece, bool IsOpened)
     {
         this->WriteFigure(Piece, -1.0, "Cube", 0.0, 0.6, 0.6, 0.96);
     }
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a goal piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayGoal(std::shared_ptr<Goal> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->WriteFigure(Piece, 0.0, "Octahedron", 0.4, 1.0, 0.2, 
                       0.96);
     this->WriteFloor(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a header.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayHeader()
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     this->NrFigures = 0;
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given monster piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayMonster(std::shared_ptr<Monster> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->WriteFigure(Piece, 0.0, "Icosahedron", 0.8, 0.4, 0.2, 
                       0.96);
     this->WriteFloor(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given player piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayPlayer(std::shared_ptr<Player> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->WriteFigure(Piece, 0.0, "Icosahedron", 0.0, 1.0, 0.2, 
                       0.96);
     this->WriteFloor(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the end of a row.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayRow()
 {
-    require(this->CheckInvariants());
-    ensure(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a trap piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayTrap(std::shared_ptr<Trap> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->WriteFloor(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given wall piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayWall(std::shared_ptr<Obstacle> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->WriteFigure(Piece, 0.0, "Cube", 0.0, 0.4, 1.0, 0.96);
     this->WriteFloor(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a water piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void CGUIHandler::DisplayWater(std::shared_ptr<Water> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->WriteFigure(Piece, -1.25, "Cube", 0.1, 0.1, 0.7, 1.0);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 void CGUIHandler::WriteFigure(Vector2<int> Position, double Height, std::string Type, double Red, double Green, double Blue, double Scale)
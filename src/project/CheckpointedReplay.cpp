@@ -0,0 +1,125 @@
+#include "CheckpointedReplay.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include "Board.h"
+#include "CommandStream.h"
+#include "Contracts.h"
+
+using namespace Arcade;
+
+const int CheckpointedReplay::DefaultInterval;
+
+/// \brief Creates a replay of the given commands, starting from
+/// the given board, that records a checkpoint every Interval
+/// commands. The replay works on a fork of the given board, so
+/// the board itself is left as it is.
+/// \pre require_cheap(Initial != nullptr);
+/// \pre require_cheap(Interval > 0);
+/// \post ensure_cheap(this->CheckInvariants());
+CheckpointedReplay::CheckpointedReplay(std::shared_ptr<Board> Initial, CommandStream Commands, int Interval)
+    : commands(std::move(Commands)), interval(Interval), cursorStep(0)
+{
+    require_cheap(Initial != nullptr);
+    require_cheap(Interval > 0);
+    this->checkpoints.push_back(Initial->Fork());
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Checks if this type's invariants are being respected.
+/// A boolean value is returned that indicates whether this is
+/// indeed the case. This method is publically visible, and can
+/// be used to verify an instance's state.
+bool CheckpointedReplay::CheckInvariants() const
+{
+    if (!this->isCheckingInvariants)
+    {
+        this->isCheckingInvariants = true;
+        bool result = this->interval > 0 && !this->checkpoints.empty() &&
+                      (this->cursor == nullptr || (this->cursorStep >= 0 && this->cursorStep <= this->commands.GetLength()));
+        this->isCheckingInvariants = false;
+        return result;
+    }
+    return true;
+}
+
+/// \brief Gets the number of commands in this replay, which is
+/// also the last step that can be sought.
+/// \pre require_cheap(this->CheckInvariants());
+int CheckpointedReplay::GetLength() const
+{
+    require_cheap(this->CheckInvariants());
+    return this->commands.GetLength();
+}
+
+/// \brief Gets the number of commands between checkpoints.
+/// \pre require_cheap(this->CheckInvariants());
+int CheckpointedReplay::GetInterval() const
+{
+    require_cheap(this->CheckInvariants());
+    return this->interval;
+}
+
+/// \brief Gets the number of checkpoints that have been recorded
+/// so far. The initial board counts as the first checkpoint.
+/// \pre require_cheap(this->CheckInvariants());
+int CheckpointedReplay::GetCheckpointCount() const
+{
+    require_cheap(this->CheckInvariants());
+    return (int)this->checkpoints.size();
+}
+
+/// \brief Gets the commands that this replay applies.
+/// \pre require_cheap(this->CheckInvariants());
+const CommandStream& CheckpointedReplay::GetCommands() const
+{
+    require_cheap(this->CheckInvariants());
+    return this->commands;
+}
+
+/// \brief Gets a board in the state that it is in after the first
+/// Step commands have been applied. The board is a fork, which
+/// the caller is free to modify. Seeking to the step after the
+/// previously sought step only applies a single command.
+/// \pre require_cheap(Step >= 0 && Step <= this->GetLength());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(result != nullptr);
+std::shared_ptr<Board> CheckpointedReplay::Seek(int Step)
+{
+    require_cheap(Step >= 0 && Step <= this->GetLength());
+    require_cheap(this->CheckInvariants());
+    int checkpoint = Step / this->interval;
+
+    // Record the checkpoints up to the one that we need.
+    while ((int)this->checkpoints.size() <= checkpoint)
+    {
+        int from = ((int)this->checkpoints.size() - 1) * this->interval;
+        auto next = this->checkpoints.back()->Fork();
+        this->Apply(*next, from, from + this->interval);
+        this->checkpoints.push_back(next);
+    }
+
+    // Continue from the cursor if it is between the checkpoint and
+    // the target step. Otherwise, start over from the checkpoint.
+    int checkpointStep = checkpoint * this->interval;
+    if (this->cursor == nullptr || this->cursorStep < checkpointStep || this->cursorStep > Step)
+    {
+        this->cursor = this->checkpoints[checkpoint]->Fork();
+        this->cursorStep = checkpointStep;
+    }
+    this->Apply(*this->cursor, this->cursorStep, Step);
+    this->cursorStep = Step;
+
+    auto result = this->cursor->Fork();
+    ensure_cheap(result != nullptr);
+    return result;
+}
+
+/// \brief Applies the commands in the range [From, To) to the
+/// given board.
+void CheckpointedReplay::Apply(Board& Target, int From, int To) const
+{
+    for (int i = From; i < To; i++)
+        this->commands.Execute(i, Target);
+}
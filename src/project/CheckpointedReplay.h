@@ -0,0 +1,81 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "Board.h"
+#include "CommandStream.h"
+#include "Contracts.h"
+
+namespace Arcade
+{
+    /// \brief Replays a command stream with random access. Every so
+    /// many commands, the replay records a checkpoint: a copy-on-write
+    /// fork of the board, which only copies what the following
+    /// commands change. Seeking to a step restores the nearest
+    /// checkpoint at or before it, and re-applies fewer commands than
+    /// the checkpoint interval, so seeking takes bounded time no
+    /// matter how long the stream is. Checkpoints are recorded the
+    /// first time that a replay gets past them.
+    class CheckpointedReplay
+    {
+    public:
+        /// \brief The checkpoint interval that front ends use.
+        static const int DefaultInterval = 256;
+
+        /// \brief Creates a replay of the given commands, starting from
+        /// the given board, that records a checkpoint every Interval
+        /// commands. The replay works on a fork of the given board, so
+        /// the board itself is left as it is.
+        /// \pre require_cheap(Initial != nullptr);
+        /// \pre require_cheap(Interval > 0);
+        /// \post ensure_cheap(this->CheckInvariants());
+        CheckpointedReplay(std::shared_ptr<Board> Initial, CommandStream Commands, int Interval);
+
+        /// \brief Checks if this type's invariants are being respected.
+        /// A boolean value is returned that indicates whether this is
+        /// indeed the case. This method is publically visible, and can
+        /// be used to verify an instance's state.
+        bool CheckInvariants() const;
+
+        /// \brief Gets the number of commands in this replay, which is
+        /// also the last step that can be sought.
+        /// \pre require_cheap(this->CheckInvariants());
+        int GetLength() const;
+
+        /// \brief Gets the number of commands between checkpoints.
+        /// \pre require_cheap(this->CheckInvariants());
+        int GetInterval() const;
+
+        /// \brief Gets the number of checkpoints that have been recorded
+        /// so far. The initial board counts as the first checkpoint.
+        /// \pre require_cheap(this->CheckInvariants());
+        int GetCheckpointCount() const;
+
+        /// \brief Gets the commands that this replay applies.
+        /// \pre require_cheap(this->CheckInvariants());
+        const CommandStream& GetCommands() const;
+
+        /// \brief Gets a board in the state that it is in after the first
+        /// Step commands have been applied. The board is a fork, which
+        /// the caller is free to modify. Seeking to the step after the
+        /// previously sought step only applies a single command.
+        /// \pre require_cheap(Step >= 0 && Step <= this->GetLength());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(result != nullptr);
+        std::shared_ptr<Board> Seek(int Step);
+    private:
+        /// \brief Applies the commands in the range [From, To) to the
+        /// given board.
+        void Apply(Board& Target, int From, int To) const;
+
+        mutable bool isCheckingInvariants = false;
+        CommandStream commands;
+        int interval;
+        /// \brief The recorded checkpoints: checkpoints[i] holds the
+        /// board after i * interval commands. Checkpoints are never
+        /// modified; boards are always forked off of them.
+        std::vector<std::shared_ptr<Board>> checkpoints;
+        /// \brief The board at the most recently sought step.
+        std::shared_ptr<Board> cursor;
+        int cursorStep;
+    };
+}
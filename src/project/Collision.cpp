@@ -5,29 +5,46 @@
 #include "Board.h"
 #include "Contracts.h"
 #include "PieceBase.h"
+#include "PieceHandle.h"
 #include "Player.h"
 #include "Vector2.h"
 
 using namespace Arcade;
 
 /// \brief Creates a new collision instance from the given arguments.
-/// \pre require(Scene != nullptr);
-/// \pre require(MovingPiece != nullptr);
-/// \pre require(StaticPiece != nullptr);
-/// \pre require(Scene->HasPiece(MovingPiece));
-/// \pre require(Scene->HasPiece(StaticPiece));
-/// \post ensure(this->CheckInvariants());
-Collision::Collision(std::shared_ptr<Board> Scene, std::shared_ptr<PieceBase> MovingPiece, std::shared_ptr<PieceBase> StaticPiece)
+/// \pre require_cheap(Scene != nullptr);
+/// \pre require_cheap(Scene->HasPiece(MovingPiece));
+/// \pre require_cheap(Scene->HasPiece(StaticPiece));
+/// \post ensure_cheap(this->CheckInvariants());
+Collision::Collision(Board* Scene, PieceHandle MovingPiece, PieceHandle StaticPiece)
 {
-    require(Scene != nullptr);
-    require(MovingPiece != nullptr);
-    require(StaticPiece != nullptr);
-    require(Scene->HasPiece(MovingPiece));
-    require(Scene->HasPiece(StaticPiece));
+    require_cheap(Scene != nullptr);
+    require_cheap(Scene->HasPiece(MovingPiece));
+    require_cheap(Scene->HasPiece(StaticPiece));
     this->SetScene(Scene);
-    this->SetMovingPiece(MovingPiece);
-    this->SetStaticPiece(StaticPiece);
-    ensure(this->CheckInvariants());
+    this->SetMovingHandle(MovingPiece);
+    this->SetStaticHandle(StaticPiece);
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Creates a new collision instance from the given arguments.
+/// \pre require_cheap(Scene != nullptr);
+/// \pre require_cheap(MovingPiece != nullptr);
+/// \pre require_cheap(StaticPiece != nullptr);
+/// \pre require_cheap(Scene->HasPiece(MovingPiece));
+/// \pre require_cheap(Scene->HasPiece(StaticPiece));
+/// \post ensure_cheap(this->CheckInvariants());
+Collision::Collision(std::shared_ptr<Board> Scene, std::shared_ptr<PieceBase> MovingPiece, std::shared_ptr<PieceBase> StaticPiece)
+{
+    require_cheap(Scene != nullptr);
+    require_cheap(MovingPiece != nullptr);
+    require_cheap(StaticPiece != nullptr);
+    require_cheap(Scene->HasPiece(MovingPiece));
+    require_cheap(Scene->HasPiece(StaticPiece));
+    this->SetScene(Scene.get());
+    this->SetMovingHandle(Scene->GetHandle(*MovingPiece));
+    this->SetStaticHandle(Scene->GetHandle(*StaticPiece));
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Checks if this type's invariants are being respected.
@@ -40,62 +57,86 @@ bool Collision::CheckInvariants() const
     {
         this->isCheckingInvariants = true;
         bool result = this->GetScene() != nullptr && 
-                      this->GetMovingPiece() != nullptr && 
-                      this->GetStaticPiece() != nullptr;
+                      this->GetMovingHandle().IsValid() && 
+                      this->GetStaticHandle().IsValid();
         this->isCheckingInvariants = false;
         return result;
     }
     return true;
 }
 
-/// \brief Gets the piece that moves and encounters another piece.
-/// \pre require(this->CheckInvariants());
-std::shared_ptr<PieceBase> Collision::GetMovingPiece() const
+/// \brief Gets a handle to the piece that moves and encounters
+/// another piece.
+/// \pre require_cheap(this->CheckInvariants());
+PieceHandle Collision::GetMovingHandle() const
 {
-    require(this->CheckInvariants());
-    return this->MovingPiece_value;
+    require_cheap(this->CheckInvariants());
+    return this->MovingHandle_value;
+}
+
+/// \brief Gets the piece that moves and encounters another piece,
+/// or null if it has been removed from the board.
+/// \pre require_cheap(this->CheckInvariants());
+PieceBase* Collision::GetMovingPiece() const
+{
+    require_cheap(this->CheckInvariants());
+    return this->GetScene()->GetPiece(this->GetMovingHandle());
 }
 
 /// \brief Sets the piece that moves and encounters another piece.
-void Collision::SetMovingPiece(std::shared_ptr<PieceBase> value)
+void Collision::SetMovingHandle(PieceHandle value)
 {
-    this->MovingPiece_value = value;
+    this->MovingHandle_value = value;
 }
 
 /// \brief Calculates the offset between the static piece and the
 /// moving piece.
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->GetMovingPiece() != nullptr);
+/// \pre require_cheap(this->GetStaticPiece() != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
 Vector2<int> Collision::GetOffset() const
 {
-    require(this->CheckInvariants());
+    require_cheap(this->GetMovingPiece() != nullptr);
+    require_cheap(this->GetStaticPiece() != nullptr);
+    require_cheap(this->CheckInvariants());
     return this->GetStaticPiece()->GetPosition() - 
            this->GetMovingPiece()->GetPosition();
 }
 
 /// \brief Gets the board where the collision takes place.
-/// \pre require(this->CheckInvariants());
-std::shared_ptr<Board> Collision::GetScene() const
+/// \pre require_cheap(this->CheckInvariants());
+Board* Collision::GetScene() const
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     return this->Scene_value;
 }
 
 /// \brief Sets the board where the collision takes place.
-void Collision::SetScene(std::shared_ptr<Board> value)
+void Collision::SetScene(Board* value)
 {
     this->Scene_value = value;
 }
 
-/// \brief Gets the piece the moving piece collides with.
-/// \pre require(this->CheckInvariants());
-std::shared_ptr<PieceBase> Collision::GetStaticPiece() const
+/// \brief Gets a handle to the piece the moving piece collides
+/// with.
+/// \pre require_cheap(this->CheckInvariants());
+PieceHandle Collision::GetStaticHandle() const
+{
+    require_cheap(this->CheckInvariants());
+    return this->StaticHandle_value;
+}
+
+/// \brief Gets the piece the moving piece collides with, or null
+/// if it has been removed from the board.
+/// \pre require_cheap(this->CheckInvariants());
+PieceBase* Collision::GetStaticPiece() const
 {
-    require(this->CheckInvariants());
-    return this->StaticPiece_value;
+    require_cheap(this->CheckInvariants());
+    return this->GetScene()->GetPiece(this->GetStaticHandle());
 }
 
 /// \brief Sets the piece the moving piece collides with.
-void Collision::SetStaticPiece(std::shared_ptr<PieceBase> value)
+void Collision::SetStaticHandle(PieceHandle value)
 {
-    this->StaticPiece_value = value;
-}
\ No newline at end of file
+    this->StaticHandle_value = value;
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <memory>
 #include "Contracts.h"
+#include "PieceHandle.h"
 #include "Vector2.h"
 
 namespace Arcade
@@ -11,16 +12,27 @@ namespace Arcade
     struct Player;
 
     /// \brief Represents a collision of two pieces on the board.
+    /// A collision does not own the board or the pieces involved:
+    /// it refers to the pieces by handle, so that passing collisions
+    /// along a chain of moves does not touch any reference counts.
+    /// The board must outlive the collision.
     class Collision
     {
     public:
         /// \brief Creates a new collision instance from the given arguments.
-        /// \pre require(Scene != nullptr);
-        /// \pre require(MovingPiece != nullptr);
-        /// \pre require(StaticPiece != nullptr);
-        /// \pre require(Scene->HasPiece(MovingPiece));
-        /// \pre require(Scene->HasPiece(StaticPiece));
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Scene != nullptr);
+        /// \pre require_cheap(Scene->HasPiece(MovingPiece));
+        /// \pre require_cheap(Scene->HasPiece(StaticPiece));
+        /// \post ensure_cheap(this->CheckInvariants());
+        Collision(Board* Scene, PieceHandle MovingPiece, PieceHandle StaticPiece);
+
+        /// \brief Creates a new collision instance from the given arguments.
+        /// \pre require_cheap(Scene != nullptr);
+        /// \pre require_cheap(MovingPiece != nullptr);
+        /// \pre require_cheap(StaticPiece != nullptr);
+        /// \pre require_cheap(Scene->HasPiece(MovingPiece));
+        /// \pre require_cheap(Scene->HasPiece(StaticPiece));
+        /// \post ensure_cheap(this->CheckInvariants());
         Collision(std::shared_ptr<Board> Scene, std::shared_ptr<PieceBase> MovingPiece, std::shared_ptr<PieceBase> StaticPiece);
 
         /// \brief Checks if this type's invariants are being respected.
@@ -33,43 +45,57 @@ namespace Arcade
         //     {
         //         this->isCheckingInvariants = true;
         //         bool result = this->GetScene() != nullptr && 
-        //                       this->GetMovingPiece() != nullptr && 
-        //                       this->GetStaticPiece() != nullptr;
+        //                       this->GetMovingHandle().IsValid() && 
+        //                       this->GetStaticHandle().IsValid();
         //         this->isCheckingInvariants = false;
         //         return result;
         //     }
         //     return true;
         // }
 
-        /// \brief Gets the piece that moves and encounters another piece.
-        /// \pre require(this->CheckInvariants());
-        std::shared_ptr<PieceBase> GetMovingPiece() const;
+        /// \brief Gets a handle to the piece that moves and encounters
+        /// another piece.
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceHandle GetMovingHandle() const;
+
+        /// \brief Gets the piece that moves and encounters another piece,
+        /// or null if it has been removed from the board.
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceBase* GetMovingPiece() const;
 
         /// \brief Gets the board where the collision takes place.
-        /// \pre require(this->CheckInvariants());
-        std::shared_ptr<Board> GetScene() const;
+        /// \pre require_cheap(this->CheckInvariants());
+        Board* GetScene() const;
+
+        /// \brief Gets a handle to the piece the moving piece collides
+        /// with.
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceHandle GetStaticHandle() const;
 
-        /// \brief Gets the piece the moving piece collides with.
-        /// \pre require(this->CheckInvariants());
-        std::shared_ptr<PieceBase> GetStaticPiece() const;
+        /// \brief Gets the piece the moving piece collides with, or null
+        /// if it has been removed from the board.
+        /// \pre require_cheap(this->CheckInvariants());
+        PieceBase* GetStaticPiece() const;
 
         /// \brief Calculates the offset between the static piece and the
         /// moving piece.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->GetMovingPiece() != nullptr);
+        /// \pre require_cheap(this->GetStaticPiece() != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
         Vector2<int> GetOffset() const;
     private:
         /// \brief Sets the piece that moves and encounters another piece.
-        void SetMovingPiece(std::shared_ptr<PieceBase> value);
+        void SetMovingHandle(PieceHandle value);
 
         /// \brief Sets the board where the collision takes place.
-        void SetScene(std::shared_ptr<Board> value);
+        void SetScene(Board* value);
 
         /// \brief Sets the piece the moving piece collides with.
-        void SetStaticPiece(std::shared_ptr<PieceBase> value);
+        void SetStaticHandle(PieceHandle value);
 
         mutable bool isCheckingInvariants = false;
-        std::shared_ptr<PieceBase> MovingPiece_value;
-        std::shared_ptr<Board> Scene_value;
-        std::shared_ptr<PieceBase> StaticPiece_value;
+        PieceHandle MovingHandle_value;
+        Board* Scene_value;
+        PieceHandle StaticHandle_value;
     };
 }
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include "CommandStream.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Actor.h"
+#include "ArraySlice.h"
+#include "AttackCommand.h"
+#include "Board.h"
+#include "Contracts.h"
+#include "ICommand.h"
+#include "MoveCommand.h"
+#include "Vector2.h"
+
+using namespace Arcade;
+
+/// \brief Creates a new, empty command stream.
+/// \post ensure_cheap(this->CheckInvariants());
+CommandStream::CommandStream()
+{
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Checks if this type's invariants are being respected.
+/// A boolean value is returned that indicates whether this is
+/// indeed the case. This method is publically visible, and can
+/// be used to verify an instance's state.
+/// \remark Several threads may execute one stream at the same time,
+/// so this method must not write to the stream.
+bool CommandStream::CheckInvariants() const
+{
+    return this->actors.size() == this->actorIndices.size();
+}
+
+/// \brief Appends an action to the end of this stream.
+/// \pre require_cheap(Actor != nullptr);
+/// \pre require_cheap(Offset != Vector2<int>());
+/// \pre require_cheap(Offset.X >= INT8_MIN && Offset.X <= INT8_MAX);
+/// \pre require_cheap(Offset.Y >= INT8_MIN && Offset.Y <= INT8_MAX);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
+void CommandStream::Append(ActionKind Kind, std::shared_ptr<Actor> Actor, Vector2<int> Offset)
+{
+    require_cheap(Actor != nullptr);
+    require_cheap(Offset != Vector2<int>());
+    require_cheap(Offset.X >= INT8_MIN && Offset.X <= INT8_MAX);
+    require_cheap(Offset.Y >= INT8_MIN && Offset.Y <= INT8_MAX);
+    require_cheap(this->CheckInvariants());
+    auto index = this->actorIndices.find(Actor->GetId());
+    if (index == this->actorIndices.end())
+    {
+        index = this->actorIndices.emplace(Actor->GetId(), (int)this->actors.size()).first;
+        this->actors.push_back(Actor);
+    }
+
+    PackedCommand command;
+    command.Actor = index->second;
+    command.Kind = Kind;
+    command.OffsetX = (std::int8_t)Offset.X;
+    command.OffsetY = (std::int8_t)Offset.Y;
+    command.Reserved = 0;
+    this->commands.push_back(command);
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Gets the number of actions in this stream.
+/// \pre require_cheap(this->CheckInvariants());
+int CommandStream::GetLength() const
+{
+    require_cheap(this->CheckInvariants());
+    return (int)this->commands.size();
+}
+
+/// \brief Gets the action at the given index.
+/// \pre require_cheap(Index >= 0 && Index < this->GetLength());
+/// \pre require_cheap(this->CheckInvariants());
+PackedCommand CommandStream::GetCommand(int Index) const
+{
+    require_cheap(Index >= 0 && Index < this->GetLength());
+    require_cheap(this->CheckInvariants());
+    return this->commands[Index];
+}
+
+/// \brief Gets the actor that performs the action at the given
+/// index.
+/// \pre require_cheap(Index >= 0 && Index < this->GetLength());
+/// \pre require_cheap(this->CheckInvariants());
+std::shared_ptr<Actor> CommandStream::GetActor(int Index) const
+{
+    require_cheap(Index >= 0 && Index < this->GetLength());
+    require_cheap(this->CheckInvariants());
+    return this->actors[this->commands[Index].Actor];
+}
+
+/// \brief Gets the offset of the action at the given index.
+/// \pre require_cheap(Index >= 0 && Index < this->GetLength());
+/// \pre require_cheap(this->CheckInvariants());
+Vector2<int> CommandStream::GetOffset(int Index) const
+{
+    require_cheap(Index >= 0 && Index < this->GetLength());
+    require_cheap(this->CheckInvariants());
+    auto& command = this->commands[Index];
+    return Vector2<int>(command.OffsetX, command.OffsetY);
+}
+
+/// \brief Executes the action at the given index on the given
+/// board, and returns a boolean that tells if the operation has
+/// completed successfully. Actors are looked up by identifier,
+/// so a stream can be executed on forks of the board it was
+/// created for.
+/// \pre require_cheap(Index >= 0 && Index < this->GetLength());
+/// \pre require_cheap(this->CheckInvariants());
+bool CommandStream::Execute(int Index, Board& Target) const
+{
+    require_cheap(Index >= 0 && Index < this->GetLength());
+    require_cheap(this->CheckInvariants());
+    auto& command = this->commands[Index];
+    auto actor = Target.GetHandle(*this->actors[command.Actor]);
+    Vector2<int> offset(command.OffsetX, command.OffsetY);
+    if (command.Kind == ActionKind::Move)
+        return MoveCommand::Apply(Target, actor, offset);
+    else
+        return AttackCommand::Apply(Target, actor, offset);
+}
+
+/// \brief Executes every action in this stream on the given
+/// board, in order, and returns the number of actions that
+/// have completed successfully.
+/// \pre require_cheap(this->CheckInvariants());
+int CommandStream::ExecuteAll(Board& Target) const
+{
+    require_cheap(this->CheckInvariants());
+    int result = 0;
+    for (int i = 0; i < this->GetLength(); i++)
+        if (this->Execute(i, Target))
+            result++;
+
+    return result;
+}
+
+/// \brief Creates a command object for every action in this
+/// stream, for use with code that expects commands.
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(result.GetLength() == this->GetLength());
+stdx::ArraySlice<std::shared_ptr<ICommand<std::shared_ptr<Board>>>> CommandStream::ToCommands() const
+{
+    require_cheap(this->CheckInvariants());
+    std::vector<std::shared_ptr<ICommand<std::shared_ptr<Board>>>> commandList;
+    commandList.reserve(this->commands.size());
+    for (int i = 0; i < this->GetLength(); i++)
+    {
+        if (this->commands[i].Kind == ActionKind::Move)
+            commandList.push_back(std::make_shared<MoveCommand>(this->GetActor(i), this->GetOffset(i)));
+        else
+            commandList.push_back(std::make_shared<AttackCommand>(this->GetActor(i), this->GetOffset(i)));
+    }
+
+    stdx::ArraySlice<std::shared_ptr<ICommand<std::shared_ptr<Board>>>> result(commandList);
+    ensure_cheap(result.GetLength() == this->GetLength());
+    return result;
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Actor.h"
+#include "ArraySlice.h"
+#include "Board.h"
+#include "Contracts.h"
+#include "ICommand.h"
+#include "Vector2.h"
+
+namespace Arcade
+{
+    /// \brief Enumerates the kinds of actions in a command stream.
+    enum class ActionKind : std::uint8_t
+    {
+        Move,
+        Attack
+    };
+
+    /// \brief Describes a single action in a command stream, packed into
+    /// eight bytes.
+    struct PackedCommand
+    {
+        /// \brief The index of the acting actor in the stream's actor
+        /// table.
+        std::int32_t Actor;
+        /// \brief The kind of action.
+        ActionKind Kind;
+        /// \brief The x-coordinate of the action's offset.
+        std::int8_t OffsetX;
+        /// \brief The y-coordinate of the action's offset.
+        std::int8_t OffsetY;
+        std::uint8_t Reserved;
+    };
+
+    static_assert(sizeof(PackedCommand) == 8, "packed commands must be eight bytes in size");
+
+    /// \brief Describes a flat sequence of actions. Every action takes up
+    /// eight bytes, and refers to its actor through a table that holds
+    /// each actor once, so long action sequences can be stored and
+    /// replayed without allocating a command object per action.
+    class CommandStream
+    {
+    public:
+        /// \brief Creates a new, empty command stream.
+        /// \post ensure_cheap(this->CheckInvariants());
+        CommandStream();
+
+        /// \brief Checks if this type's invariants are being respected.
+        /// A boolean value is returned that indicates whether this is
+        /// indeed the case. This method is publically visible, and can
+        /// be used to verify an instance's state.
+        /// \remark Several threads may execute one stream at the same time,
+        /// so this method must not write to the stream.
+        bool CheckInvariants() const;
+
+        /// \brief Appends an action to the end of this stream.
+        /// \pre require_cheap(Actor != nullptr);
+        /// \pre require_cheap(Offset != Vector2<int>());
+        /// \pre require_cheap(Offset.X >= INT8_MIN && Offset.X <= INT8_MAX);
+        /// \pre require_cheap(Offset.Y >= INT8_MIN && Offset.Y <= INT8_MAX);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
+        void Append(ActionKind Kind, std::shared_ptr<Actor> Actor, Vector2<int> Offset);
+
+        /// \brief Gets the number of actions in this stream.
+        /// \pre require_cheap(this->CheckInvariants());
+        int GetLength() const;
+
+        /// \brief Gets the action at the given index.
+        /// \pre require_cheap(Index >= 0 && Index < this->GetLength());
+        /// \pre require_cheap(this->CheckInvariants());
+        PackedCommand GetCommand(int Index) const;
+
+        /// \brief Gets the actor that performs the action at the given
+        /// index.
+        /// \pre require_cheap(Index >= 0 && Index < this->GetLength());
+        /// \pre require_cheap(this->CheckInvariants());
+        std::shared_ptr<Actor> GetActor(int Index) const;
+
+        /// \brief Gets the offset of the action at the given index.
+        /// \pre require_cheap(Index >= 0 && Index < this->GetLength());
+        /// \pre require_cheap(this->CheckInvariants());
+        Vector2<int> GetOffset(int Index) const;
+
+        /// \brief Executes the action at the given index on the given
+        /// board, and returns a boolean that tells if the operation has
+        /// completed successfully. Actors are looked up by identifier,
+        /// so a stream can be executed on forks of the board it was
+        /// created for.
+        /// \pre require_cheap(Index >= 0 && Index < this->GetLength());
+        /// \pre require_cheap(this->CheckInvariants());
+        bool Execute(int Index, Board& Target) const;
+
+        /// \brief Executes every action in this stream on the given
+        /// board, in order, and returns the number of actions that
+        /// have completed successfully.
+        /// \pre require_cheap(this->CheckInvariants());
+        int ExecuteAll(Board& Target) const;
+
+        /// \brief Creates a command object for every action in this
+        /// stream, for use with code that expects commands.
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(result.GetLength() == this->GetLength());
+        stdx::ArraySlice<std::shared_ptr<ICommand<std::shared_ptr<Board>>>> ToCommands() const;
+    private:
+        std::vector<PackedCommand> commands;
+        std::vector<std::shared_ptr<Actor>> actors;
+        /// \brief Maps actor identifiers to indices in the actor table.
+        std::unordered_map<int, int> actorIndices;
+    };
+}
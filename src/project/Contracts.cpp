@@ -0,0 +1,187 @@
+#include "Contracts.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+using namespace Arcade;
+
+namespace
+{
+#ifdef CONTRACT_POLICY_LOG
+    std::atomic<int> policy(static_cast<int>(ContractPolicy::LogAndCount));
+#else
+    std::atomic<int> policy(static_cast<int>(ContractPolicy::Abort));
+#endif
+    std::atomic<long> violationCount(0);
+
+    /// \brief Describes the contract profiler's list of contract sites.
+    /// The profile and its sites are never destroyed, so they are
+    /// still around when the profile is written at exit.
+    struct ContractProfile
+    {
+        std::mutex Lock;
+        std::vector<ContractSite*> Sites;
+    };
+
+    ContractProfile& GetContractProfile()
+    {
+        static ContractProfile* profile = new ContractProfile();
+        return *profile;
+    }
+
+    /// \brief The innermost contract that is being timed on this thread.
+    thread_local ContractTimer* currentTimer = nullptr;
+
+    std::int64_t GetTimestamp()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+#ifdef CONTRACT_PROFILE
+    /// \brief Writes the contract profile to standard error, or to
+    /// the file that CONTRACT_PROFILE_FILE names.
+    void WriteContractProfileAtExit()
+    {
+        const char* fileName = std::getenv("CONTRACT_PROFILE_FILE");
+        if (fileName != nullptr && *fileName != '\0')
+        {
+            std::ofstream stream(fileName);
+            WriteContractProfile(stream);
+        }
+        else
+        {
+            WriteContractProfile(std::cerr);
+        }
+    }
+#endif
+}
+
+/// \brief Gets the way in which contract violations are handled.
+/// The policy is Abort, unless CONTRACT_POLICY_LOG is defined.
+ContractPolicy Arcade::GetContractPolicy()
+{
+    return static_cast<ContractPolicy>(policy.load());
+}
+
+/// \brief Sets the way in which contract violations are handled.
+void Arcade::SetContractPolicy(ContractPolicy Value)
+{
+    policy.store(static_cast<int>(Value));
+}
+
+/// \brief Gets the number of contract violations that have been
+/// counted since the program started, or since the count was
+/// last reset.
+long Arcade::GetContractViolationCount()
+{
+    return violationCount.load();
+}
+
+/// \brief Resets the number of counted contract violations to zero.
+void Arcade::ResetContractViolationCount()
+{
+    violationCount.store(0);
+}
+
+/// \brief Handles a contract violation according to the current
+/// contract policy.
+void Arcade::ReportContractViolation(const char* Kind, const char* Condition, const char* File, int Line)
+{
+    std::cerr << File << ":" << Line << ": " << Kind << " '" << Condition << "' failed." << std::endl;
+    if (GetContractPolicy() == ContractPolicy::Abort)
+        std::abort();
+
+    violationCount++;
+}
+
+/// \brief Registers a contract's source location with the contract
+/// profiler. Sites live until the program exits. If the profiler
+/// is enabled, the first registration arranges for the profile to
+/// be written at exit.
+ContractSite& Arcade::RegisterContractSite(const char* Kind, const char* Tier, const char* Condition, const char* File, int Line)
+{
+    auto site = new ContractSite();
+    site->Kind = Kind;
+    site->Tier = Tier;
+    site->Condition = Condition;
+    site->File = File;
+    site->Line = Line;
+    site->Hits = 0;
+    site->TotalTime = 0;
+    site->SelfTime = 0;
+
+    auto& profile = GetContractProfile();
+    std::lock_guard<std::mutex> guard(profile.Lock);
+#ifdef CONTRACT_PROFILE
+    if (profile.Sites.empty())
+        std::atexit(WriteContractProfileAtExit);
+#endif
+    profile.Sites.push_back(site);
+    return *site;
+}
+
+/// \brief Writes the contract profile to the given stream. Contracts
+/// are listed by their total time, in descending order.
+void Arcade::WriteContractProfile(std::ostream& Stream)
+{
+    auto& profile = GetContractProfile();
+    std::vector<ContractSite*> sites;
+    {
+        std::lock_guard<std::mutex> guard(profile.Lock);
+        sites = profile.Sites;
+    }
+    std::stable_sort(sites.begin(), sites.end(), [](const ContractSite* Left, const ContractSite* Right)
+    {
+        return Left->TotalTime.load() > Right->TotalTime.load();
+    });
+
+    auto flags = Stream.flags();
+    auto precision = Stream.precision();
+    Stream << std::setw(12) << "hits" << std::setw(14) << "total (ms)"
+           << std::setw(14) << "self (ms)" << std::setw(12) << "avg (ns)"
+           << "  tier       contract" << std::endl;
+    for (auto site : sites)
+    {
+        std::int64_t hits = site->Hits.load();
+        std::int64_t total = site->TotalTime.load();
+        std::int64_t self = site->SelfTime.load();
+        Stream << std::setw(12) << hits
+               << std::setw(14) << std::fixed << std::setprecision(3) << total / 1e6
+               << std::setw(14) << self / 1e6
+               << std::setw(12) << std::setprecision(1) << (hits > 0 ? (double)total / hits : 0.0)
+               << "  " << std::left << std::setw(10) << site->Tier << std::right
+               << " " << site->File << ":" << site->Line << ": "
+               << site->Kind << " '" << site->Condition << "'" << std::endl;
+    }
+    Stream.flags(flags);
+    Stream.precision(precision);
+}
+
+/// \brief Starts timing the given contract.
+ContractTimer::ContractTimer(ContractSite& Site)
+    : site(Site), parent(currentTimer), childTime(0)
+{
+    currentTimer = this;
+    this->start = GetTimestamp();
+}
+
+/// \brief Stops timing the contract, and records the results.
+ContractTimer::~ContractTimer()
+{
+    std::int64_t elapsed = GetTimestamp() - this->start;
+    this->site.Hits++;
+    this->site.TotalTime += elapsed;
+    this->site.SelfTime += elapsed - this->childTime;
+    if (this->parent != nullptr)
+        this->parent->childTime += elapsed;
+    currentTimer = this->parent;
+}
@@ -1,4 +1,165 @@
-#include <cassert>
+#pragma once
 
-#define require assert
-#define ensure assert
+// Contracts come in three cost tiers:
+//
+//  * cheap contracts take constant time, such as null checks and
+//    most invariants,
+//  * linear contracts take time that is proportional to the size
+//    of some collection, such as a gate's list of buttons, and
+//  * expensive contracts may take longer still.
+//
+// CONTRACT_LEVEL picks the most costly tier that is checked. It
+// defaults to CONTRACT_LEVEL_EXPENSIVE, i.e. every contract, in
+// debug builds and to CONTRACT_LEVEL_CHEAP in NDEBUG builds, so
+// release builds still catch the violations that are cheap to
+// catch. Pass -DCONTRACT_LEVEL=<level> to override this.
+//
+// Plain require and ensure are unclassified contracts. They are
+// treated as expensive ones.
+//
+// Defining CONTRACT_PROFILE makes every checked contract record
+// how often it is evaluated, and how long that takes, per source
+// location. A report that lists the most costly contracts first
+// is written to standard error when the program exits, or to the
+// file that the CONTRACT_PROFILE_FILE environment variable names.
+
+#define CONTRACT_LEVEL_NONE 0
+#define CONTRACT_LEVEL_CHEAP 1
+#define CONTRACT_LEVEL_LINEAR 2
+#define CONTRACT_LEVEL_EXPENSIVE 3
+
+#ifndef CONTRACT_LEVEL
+#ifdef NDEBUG
+#define CONTRACT_LEVEL CONTRACT_LEVEL_CHEAP
+#else
+#define CONTRACT_LEVEL CONTRACT_LEVEL_EXPENSIVE
+#endif
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+namespace Arcade
+{
+    /// \brief Enumerates the ways in which contract violations can
+    /// be handled.
+    enum class ContractPolicy
+    {
+        /// \brief Logs the violation to standard error, and aborts.
+        Abort,
+        /// \brief Logs the violation to standard error, counts it, and
+        /// carries on.
+        LogAndCount
+    };
+
+    /// \brief Gets the way in which contract violations are handled.
+    /// The policy is Abort, unless CONTRACT_POLICY_LOG is defined.
+    ContractPolicy GetContractPolicy();
+
+    /// \brief Sets the way in which contract violations are handled.
+    void SetContractPolicy(ContractPolicy Value);
+
+    /// \brief Gets the number of contract violations that have been
+    /// counted since the program started, or since the count was
+    /// last reset.
+    long GetContractViolationCount();
+
+    /// \brief Resets the number of counted contract violations to zero.
+    void ResetContractViolationCount();
+
+    /// \brief Handles a contract violation according to the current
+    /// contract policy.
+    void ReportContractViolation(const char* Kind, const char* Condition, const char* File, int Line);
+
+    /// \brief Describes a contract's source location, along with the
+    /// statistics that the contract profiler has gathered for it.
+    struct ContractSite
+    {
+        const char* Kind;
+        const char* Tier;
+        const char* Condition;
+        const char* File;
+        int Line;
+        /// \brief The number of times that the contract has been checked.
+        std::atomic<std::int64_t> Hits;
+        /// \brief The time spent checking the contract, in nanoseconds,
+        /// including the time spent in nested contracts.
+        std::atomic<std::int64_t> TotalTime;
+        /// \brief The time spent checking the contract, in nanoseconds,
+        /// excluding the time spent in nested contracts.
+        std::atomic<std::int64_t> SelfTime;
+    };
+
+    /// \brief Registers a contract's source location with the contract
+    /// profiler. Sites live until the program exits. If the profiler
+    /// is enabled, the first registration arranges for the profile to
+    /// be written at exit.
+    ContractSite& RegisterContractSite(const char* Kind, const char* Tier, const char* Condition, const char* File, int Line);
+
+    /// \brief Writes the contract profile to the given stream. Contracts
+    /// are listed by their total time, in descending order.
+    void WriteContractProfile(std::ostream& Stream);
+
+    /// \brief Times the evaluation of a contract, from its construction
+    /// to its destruction, and adds the result to the contract's site.
+    /// Timers on the same thread nest, so time spent in a nested
+    /// contract is not counted as a contract's self time.
+    class ContractTimer
+    {
+    public:
+        /// \brief Starts timing the given contract.
+        explicit ContractTimer(ContractSite& Site);
+
+        /// \brief Stops timing the contract, and records the results.
+        ~ContractTimer();
+    private:
+        ContractTimer(const ContractTimer&) = delete;
+        ContractTimer& operator=(const ContractTimer&) = delete;
+
+        ContractSite& site;
+        ContractTimer* parent;
+        std::int64_t start;
+        std::int64_t childTime;
+    };
+}
+
+#ifdef CONTRACT_PROFILE
+#define CONTRACT_CHECK(Kind, Tier, Condition) \
+    ([&]() -> bool \
+    { \
+        static ::Arcade::ContractSite& contractSite = ::Arcade::RegisterContractSite(Kind, Tier, #Condition, __FILE__, __LINE__); \
+        ::Arcade::ContractTimer contractTimer(contractSite); \
+        return (Condition) ? true : false; \
+    }() ? (void)0 : ::Arcade::ReportContractViolation(Kind, #Condition, __FILE__, __LINE__))
+#else
+#define CONTRACT_CHECK(Kind, Tier, Condition) \
+    ((Condition) ? (void)0 : ::Arcade::ReportContractViolation(Kind, #Condition, __FILE__, __LINE__))
+#endif
+
+#if CONTRACT_LEVEL >= CONTRACT_LEVEL_CHEAP
+#define require_cheap(Condition) CONTRACT_CHECK("precondition", "cheap", Condition)
+#define ensure_cheap(Condition) CONTRACT_CHECK("postcondition", "cheap", Condition)
+#else
+#define require_cheap(Condition) ((void)0)
+#define ensure_cheap(Condition) ((void)0)
+#endif
+
+#if CONTRACT_LEVEL >= CONTRACT_LEVEL_LINEAR
+#define require_linear(Condition) CONTRACT_CHECK("precondition", "linear", Condition)
+#define ensure_linear(Condition) CONTRACT_CHECK("postcondition", "linear", Condition)
+#else
+#define require_linear(Condition) ((void)0)
+#define ensure_linear(Condition) ((void)0)
+#endif
+
+#if CONTRACT_LEVEL >= CONTRACT_LEVEL_EXPENSIVE
+#define require_expensive(Condition) CONTRACT_CHECK("precondition", "expensive", Condition)
+#define ensure_expensive(Condition) CONTRACT_CHECK("postcondition", "expensive", Condition)
+#else
+#define require_expensive(Condition) ((void)0)
+#define ensure_expensive(Condition) ((void)0)
+#endif
+
+#define require require_expensive
+#define ensure ensure_expensive
@@ -0,0 +1,216 @@
+#pragma once
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace stdx
+{
+    /// \brief A persistent vector that shares its storage with its
+    /// copies. Copying a CowVector takes constant time, regardless of
+    /// its length. Elements are stored in a shallow tree of fixed-size
+    /// nodes; writing to an element only copies the nodes on the path
+    /// from the root to that element that are still shared with
+    /// another copy.
+    /// \remark Distinct copies may be read and written by different
+    /// threads at the same time. Nodes keep an atomic reference
+    /// count, so a thread that finds a node unshared also sees
+    /// every access that other threads made through their
+    /// copies before they let go of it.
+    template<typename T>
+    class CowVector
+    {
+    public:
+        typedef int size_type;
+
+        /// \brief Creates an empty vector.
+        CowVector() : root(nullptr), count(0), shift(0) { }
+
+        /// \brief Gets the number of elements in this vector.
+        size_type size() const { return this->count; }
+        /// \brief Tells if this vector is empty.
+        bool empty() const { return this->count == 0; }
+
+        /// \brief Gets the element at the given index.
+        const T& operator[](size_type Index) const
+        {
+            assert(Index >= 0 && Index < this->count);
+            return this->GetLeaf(Index)->Values[Index & Mask];
+        }
+
+        /// \brief Gets a mutable reference to the element at the given
+        /// index. Any nodes on the path to the element that are shared
+        /// with other vectors are copied first.
+        T& GetMutable(size_type Index)
+        {
+            assert(Index >= 0 && Index < this->count);
+            NodePtr* node = &this->root;
+            for (int level = this->shift; level > 0; level -= Bits)
+            {
+                auto branch = Unshare<Branch>(*node);
+                node = &branch->Children[(Index >> level) & Mask];
+            }
+            return Unshare<Leaf>(*node)->Values[Index & Mask];
+        }
+
+        /// \brief Appends the given element to this vector.
+        void push_back(const T& Value)
+        {
+            if (this->root.get() != nullptr && this->count == (Width << this->shift))
+            {
+                // The tree is full. Grow it by one level.
+                auto branch = new Branch();
+                branch->Children[0] = std::move(this->root);
+                this->root = NodePtr(branch);
+                this->shift += Bits;
+            }
+
+            NodePtr* node = &this->root;
+            for (int level = this->shift; level > 0; level -= Bits)
+            {
+                if (node->get() == nullptr)
+                    *node = NodePtr(new Branch());
+                auto branch = Unshare<Branch>(*node);
+                node = &branch->Children[(this->count >> level) & Mask];
+            }
+            if (node->get() == nullptr)
+                *node = NodePtr(new Leaf());
+            Unshare<Leaf>(*node)->Values[this->count & Mask] = Value;
+            this->count++;
+        }
+
+        /// \brief Removes all elements from this vector.
+        void clear()
+        {
+            this->root = NodePtr();
+            this->count = 0;
+            this->shift = 0;
+        }
+
+    private:
+        static const int Bits = 5;
+        static const int Width = 1 << Bits;
+        static const int Mask = Width - 1;
+
+        /// \brief A tree node, which counts the references to it. A
+        /// copy of a node starts out with a single reference.
+        struct Node
+        {
+            Node() : References(1) { }
+            Node(const Node&) : References(1) { }
+            virtual ~Node() { }
+
+            std::atomic<int> References;
+        };
+
+        /// \brief Holds a reference to a node, or to no node at all.
+        class NodePtr
+        {
+        public:
+            NodePtr() : node(nullptr) { }
+            /// \brief Takes over the single reference to a new node.
+            explicit NodePtr(Node* Value) : node(Value) { }
+            NodePtr(const NodePtr& Other) : node(Other.node)
+            {
+                if (this->node != nullptr)
+                    this->node->References.fetch_add(1, std::memory_order_relaxed);
+            }
+            NodePtr(NodePtr&& Other) : node(Other.node) { Other.node = nullptr; }
+            ~NodePtr()
+            {
+                if (this->node != nullptr && this->node->References.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    delete this->node;
+            }
+
+            NodePtr& operator=(NodePtr Other)
+            {
+                std::swap(this->node, Other.node);
+                return *this;
+            }
+
+            /// \brief Gets the node, or null.
+            Node* get() const { return this->node; }
+
+            /// \brief Tells if this is the only reference to the node.
+            bool IsUnique() const { return this->node->References.load(std::memory_order_acquire) == 1; }
+
+        private:
+            Node* node;
+        };
+
+        struct Leaf : Node
+        {
+            T Values[Width];
+        };
+
+        struct Branch : Node
+        {
+            NodePtr Children[Width];
+        };
+
+        /// \brief Makes sure that the given node is not shared with any
+        /// other vector, and returns it.
+        template<typename TNode>
+        static TNode* Unshare(NodePtr& Value)
+        {
+            if (!Value.IsUnique())
+                Value = NodePtr(new TNode(*static_cast<TNode*>(Value.get())));
+            return static_cast<TNode*>(Value.get());
+        }
+
+        /// \brief Gets the leaf that contains the element at the given
+        /// index.
+        const Leaf* GetLeaf(size_type Index) const
+        {
+            const Node* node = this->root.get();
+            for (int level = this->shift; level > 0; level -= Bits)
+                node = static_cast<const Branch*>(node)->Children[(Index >> level) & Mask].get();
+            return static_cast<const Leaf*>(node);
+        }
+
+        NodePtr root;
+        size_type count;
+        int shift;
+
+    public:
+        class const_iterator
+        {
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef T value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const T* pointer;
+            typedef const T& reference;
+
+            const_iterator() : vector(nullptr), leaf(nullptr), index(0) { }
+            const_iterator(const CowVector<T>* Vector, size_type Index)
+                : vector(Vector), leaf(nullptr), index(Index)
+            {
+                if (Index < Vector->count)
+                    this->leaf = Vector->GetLeaf(Index);
+            }
+
+            const T& operator*() const { return this->leaf->Values[this->index & Mask]; }
+            const T* operator->() const { return &**this; }
+            const_iterator& operator++()
+            {
+                this->index++;
+                if ((this->index & Mask) == 0 && this->index < this->vector->count)
+                    this->leaf = this->vector->GetLeaf(this->index);
+                return *this;
+            }
+            const_iterator operator++(int) { auto result = *this; ++*this; return result; }
+            bool operator==(const const_iterator& Other) const { return this->index == Other.index; }
+            bool operator!=(const const_iterator& Other) const { return this->index != Other.index; }
+
+        private:
+            const CowVector<T>* vector;
+            const Leaf* leaf;
+            size_type index;
+        };
+
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, this->count); }
+    };
+}
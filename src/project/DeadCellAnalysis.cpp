@@ -0,0 +1,261 @@
+#include "DeadCellAnalysis.h"
+
+#include <vector>
+#include "Board.h"
+#include "Button.h"
+#include "Contracts.h"
+#include "Goal.h"
+#include "IsInstance.h"
+#include "Obstacle.h"
+#include "PieceBase.h"
+#include "PieceHandle.h"
+#include "Player.h"
+#include "Trap.h"
+#include "Vector2.h"
+#include "Water.h"
+
+using namespace Arcade;
+
+namespace
+{
+    const Vector2<int> directions[] = { Vector2<int>(-1, 0), Vector2<int>(1, 0), Vector2<int>(0, 1), Vector2<int>(0, -1) };
+}
+
+/// \brief Analyses the given board.
+/// \post ensure_cheap(this->CheckInvariants());
+DeadCellAnalysis::DeadCellAnalysis(const Board& Scene)
+    : width(Scene.GetWidth()), height(Scene.GetHeight())
+{
+    int cellCount = this->width * this->height;
+    this->isWall.assign(cellCount, false);
+    this->isGoal.assign(cellCount, false);
+    for (auto& obstacle : Scene.GetObstacles())
+        if (!obstacle->GetMovable())
+            this->isWall[this->GetIndex(obstacle->GetPosition())] = true;
+    for (auto& goal : Scene.GetGoals())
+        this->isGoal[this->GetIndex(goal->GetPosition())] = true;
+
+    // Work backwards from the cells where a barrel is of use. A barrel
+    // can be pushed from a cell onto a live cell if the cell behind it
+    // is open for the player that pushes it.
+    std::vector<bool> isLive(cellCount, false);
+    std::vector<Vector2<int>> pending;
+    auto addTarget = [&](Vector2<int> Position)
+    {
+        if (!this->isWall[this->GetIndex(Position)] && !isLive[this->GetIndex(Position)])
+        {
+            isLive[this->GetIndex(Position)] = true;
+            pending.push_back(Position);
+        }
+    };
+    for (auto& button : Scene.GetButtons())
+        addTarget(button->GetPosition());
+    for (auto& water : Scene.GetWater())
+        addTarget(water->GetPosition());
+    for (auto& trap : Scene.GetTraps())
+        addTarget(trap->GetPosition());
+
+    while (!pending.empty())
+    {
+        auto target = pending.back();
+        pending.pop_back();
+        for (auto& direction : directions)
+        {
+            auto source = target - direction;
+            if (this->IsOpen(source) && this->IsOpen(source - direction))
+                addTarget(source);
+        }
+    }
+
+    this->isDead.assign(cellCount, false);
+    this->isFrozen.assign(cellCount, false);
+    for (int y = 0; y < this->height; y++)
+    {
+        for (int x = 0; x < this->width; x++)
+        {
+            Vector2<int> position(x, y);
+            int index = this->GetIndex(position);
+            this->isDead[index] = !isLive[index];
+
+            // A barrel can only be pushed along an axis if the cells on
+            // both sides of it are open: one for the player, one for the
+            // barrel.
+            bool isHorizontalOpen = this->IsOpen(position + directions[0]) && this->IsOpen(position + directions[1]);
+            bool isVerticalOpen = this->IsOpen(position + directions[2]) && this->IsOpen(position + directions[3]);
+            this->isFrozen[index] = !isHorizontalOpen && !isVerticalOpen;
+        }
+    }
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Checks if this type's invariants are being respected.
+/// A boolean value is returned that indicates whether this is
+/// indeed the case. This method is publically visible, and can
+/// be used to verify an instance's state.
+bool DeadCellAnalysis::CheckInvariants() const
+{
+    if (!this->isCheckingInvariants)
+    {
+        this->isCheckingInvariants = true;
+        std::size_t cellCount = (std::size_t)this->width * this->height;
+        bool result = this->width >= 0 && this->height >= 0 &&
+                      this->isWall.size() == cellCount && this->isDead.size() == cellCount &&
+                      this->isFrozen.size() == cellCount && this->isGoal.size() == cellCount;
+        this->isCheckingInvariants = false;
+        return result;
+    }
+    return true;
+}
+
+/// \brief Gets a boolean value that tells if the given cell is a
+/// wall, i.e. an immovable obstacle.
+/// \pre require_cheap(this->InRange(Position));
+/// \pre require_cheap(this->CheckInvariants());
+bool DeadCellAnalysis::IsWall(Vector2<int> Position) const
+{
+    require_cheap(this->InRange(Position));
+    require_cheap(this->CheckInvariants());
+    return this->isWall[this->GetIndex(Position)];
+}
+
+/// \brief Gets a boolean value that tells if a barrel on the given
+/// cell can never be pushed onto a button, or into water or a
+/// trap.
+/// \pre require_cheap(this->InRange(Position));
+/// \pre require_cheap(this->CheckInvariants());
+bool DeadCellAnalysis::IsDeadCell(Vector2<int> Position) const
+{
+    require_cheap(this->InRange(Position));
+    require_cheap(this->CheckInvariants());
+    return this->isDead[this->GetIndex(Position)];
+}
+
+/// \brief Gets a boolean value that tells if a barrel on the given
+/// cell can never be pushed again, because walls or edges
+/// block it along both axes.
+/// \pre require_cheap(this->InRange(Position));
+/// \pre require_cheap(this->CheckInvariants());
+bool DeadCellAnalysis::IsFrozenCell(Vector2<int> Position) const
+{
+    require_cheap(this->InRange(Position));
+    require_cheap(this->CheckInvariants());
+    return this->isFrozen[this->GetIndex(Position)];
+}
+
+/// \brief Gets the number of dead cells that are not walls.
+/// \pre require_cheap(this->CheckInvariants());
+int DeadCellAnalysis::GetDeadCellCount() const
+{
+    require_cheap(this->CheckInvariants());
+    int result = 0;
+    for (std::size_t i = 0; i < this->isDead.size(); i++)
+        if (this->isDead[i] && !this->isWall[i])
+            result++;
+    return result;
+}
+
+/// \brief Gets a boolean value that tells if the given position
+/// lies on the analysed board.
+bool DeadCellAnalysis::InRange(Vector2<int> Position) const
+{
+    return Position.X >= 0 && Position.Y >= 0 && Position.X < this->width && Position.Y < this->height;
+}
+
+/// \brief Tells what happens to the barrel, if any, that the given
+/// piece pushes when it moves by the given offset on the given
+/// board, assuming that the push succeeds. A push that freezes
+/// a barrel is Dead if the frozen barrels then wall every
+/// player off from every goal. The given board must be the
+/// analysed board or one of its forks. Checking a push that
+/// does not freeze a barrel takes constant time.
+/// \remark This method may be called concurrently with itself.
+PushVerdict DeadCellAnalysis::ClassifyPush(const Board& Scene, PieceHandle Pusher, Vector2<int> Offset) const
+{
+    auto pusher = Scene.GetPiece(Pusher);
+    if (pusher == nullptr)
+        return PushVerdict::None;
+
+    auto source = pusher->GetPosition() + Offset;
+    auto target = source + Offset;
+    if (!this->InRange(source) || !this->IsOpen(target))
+        return PushVerdict::None;
+
+    // Pieces are looked up by handle, so that solvers can classify
+    // pushes without touching any reference counts.
+    auto barrel = Scene.GetPiece(Scene.GetItemHandle(source));
+    if (barrel == nullptr || !stdx::isinstance<Obstacle>(*barrel) || !barrel->GetMovable())
+        return PushVerdict::None;
+
+    // Barrels that are pushed into water or a trap are used up.
+    auto occupant = Scene.GetPiece(Scene.GetItemHandle(target));
+    if (occupant != nullptr && (stdx::isinstance<Water>(*occupant) || stdx::isinstance<Trap>(*occupant)))
+        return PushVerdict::Live;
+
+    int index = this->GetIndex(target);
+    if (this->isFrozen[index] && !this->CanReachGoal(Scene, target))
+        return PushVerdict::Dead;
+    else if (this->isDead[index])
+        return PushVerdict::Wasted;
+    else
+        return PushVerdict::Live;
+}
+
+/// \brief Gets the index of the given cell, in row-major order.
+int DeadCellAnalysis::GetIndex(Vector2<int> Position) const
+{
+    return Position.Y * this->width + Position.X;
+}
+
+/// \brief Gets a boolean value that tells if a barrel or a player
+/// could ever be on the given cell.
+bool DeadCellAnalysis::IsOpen(Vector2<int> Position) const
+{
+    return this->InRange(Position) && !this->isWall[this->GetIndex(Position)];
+}
+
+/// \brief Gets a boolean value that tells if a player on the given
+/// board can reach a goal, if every frozen barrel and the given
+/// cell are treated as walls.
+bool DeadCellAnalysis::CanReachGoal(const Board& Scene, Vector2<int> Blocked) const
+{
+    // Frozen barrels never move again, and nothing else removes them.
+    // Every other piece is assumed to get out of the way eventually.
+    auto isClosed = this->isWall;
+    isClosed[this->GetIndex(Blocked)] = true;
+    for (auto& obstacle : Scene.GetObstacles())
+    {
+        int index = this->GetIndex(obstacle->GetPosition());
+        if (obstacle->GetMovable() && this->isFrozen[index])
+            isClosed[index] = true;
+    }
+
+    std::vector<Vector2<int>> pending;
+    for (auto& player : Scene.GetPlayers())
+    {
+        int index = this->GetIndex(player->GetPosition());
+        if (!isClosed[index])
+        {
+            isClosed[index] = true;
+            pending.push_back(player->GetPosition());
+        }
+    }
+
+    while (!pending.empty())
+    {
+        auto position = pending.back();
+        pending.pop_back();
+        if (this->isGoal[this->GetIndex(position)])
+            return true;
+
+        for (auto& direction : directions)
+        {
+            auto next = position + direction;
+            if (this->InRange(next) && !isClosed[this->GetIndex(next)])
+            {
+                isClosed[this->GetIndex(next)] = true;
+                pending.push_back(next);
+            }
+        }
+    }
+    return false;
+}
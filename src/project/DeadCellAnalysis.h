@@ -0,0 +1,113 @@
+#pragma once
+#include <vector>
+#include "Board.h"
+#include "Contracts.h"
+#include "PieceHandle.h"
+#include "Vector2.h"
+
+namespace Arcade
+{
+    /// \brief Enumerates the ways in which a move can push a barrel.
+    enum class PushVerdict
+    {
+        /// \brief The move does not push a barrel.
+        None,
+        /// \brief The barrel can still be pushed onto a button, or it is
+        /// pushed into water or a trap.
+        Live,
+        /// \brief The barrel ends up on a dead cell, so it can never be
+        /// pushed onto a button, or into water or a trap. It can
+        /// still be pushed out of the way.
+        Wasted,
+        /// \brief The barrel ends up stuck in a place that cuts every
+        /// player off from every goal, so the game can no longer be
+        /// won.
+        Dead
+    };
+
+    /// \brief Describes a static analysis of the cells that barrels, i.e.
+    /// movable obstacles, can be pushed to on a board. A barrel is
+    /// only of use on a button, in water or in a trap. A cell is dead
+    /// if a barrel on it can never be pushed to any of those, because
+    /// walls and the board's edges are in the way: corners, edges
+    /// that are lined with walls and hold no button, and the like. A
+    /// cell is frozen if a barrel on it can never be pushed at all.
+    /// The analysis only looks at walls, which never change, so it
+    /// applies to the analysed board and to all of its forks. It
+    /// assumes that every other piece can get out of the way.
+    class DeadCellAnalysis
+    {
+    public:
+        /// \brief Analyses the given board.
+        /// \post ensure_cheap(this->CheckInvariants());
+        explicit DeadCellAnalysis(const Board& Scene);
+
+        /// \brief Checks if this type's invariants are being respected.
+        /// A boolean value is returned that indicates whether this is
+        /// indeed the case. This method is publically visible, and can
+        /// be used to verify an instance's state.
+        bool CheckInvariants() const;
+
+        /// \brief Gets a boolean value that tells if the given cell is a
+        /// wall, i.e. an immovable obstacle.
+        /// \pre require_cheap(this->InRange(Position));
+        /// \pre require_cheap(this->CheckInvariants());
+        bool IsWall(Vector2<int> Position) const;
+
+        /// \brief Gets a boolean value that tells if a barrel on the given
+        /// cell can never be pushed onto a button, or into water or a
+        /// trap.
+        /// \pre require_cheap(this->InRange(Position));
+        /// \pre require_cheap(this->CheckInvariants());
+        bool IsDeadCell(Vector2<int> Position) const;
+
+        /// \brief Gets a boolean value that tells if a barrel on the given
+        /// cell can never be pushed again, because walls or edges
+        /// block it along both axes.
+        /// \pre require_cheap(this->InRange(Position));
+        /// \pre require_cheap(this->CheckInvariants());
+        bool IsFrozenCell(Vector2<int> Position) const;
+
+        /// \brief Gets the number of dead cells that are not walls.
+        /// \pre require_cheap(this->CheckInvariants());
+        int GetDeadCellCount() const;
+
+        /// \brief Gets a boolean value that tells if the given position
+        /// lies on the analysed board.
+        bool InRange(Vector2<int> Position) const;
+
+        /// \brief Tells what happens to the barrel, if any, that the given
+        /// piece pushes when it moves by the given offset on the given
+        /// board, assuming that the push succeeds. A push that freezes
+        /// a barrel is Dead if the frozen barrels then wall every
+        /// player off from every goal. The given board must be the
+        /// analysed board or one of its forks. Checking a push that
+        /// does not freeze a barrel takes constant time.
+        /// \remark This method may be called concurrently with itself.
+        PushVerdict ClassifyPush(const Board& Scene, PieceHandle Pusher, Vector2<int> Offset) const;
+    private:
+        /// \brief Gets the index of the given cell, in row-major order.
+        int GetIndex(Vector2<int> Position) const;
+
+        /// \brief Gets a boolean value that tells if a barrel or a player
+        /// could ever be on the given cell.
+        bool IsOpen(Vector2<int> Position) const;
+
+        /// \brief Gets a boolean value that tells if a player on the given
+        /// board can reach a goal, if every frozen barrel and the given
+        /// cell are treated as walls.
+        bool CanReachGoal(const Board& Scene, Vector2<int> Blocked) const;
+
+        mutable bool isCheckingInvariants = false;
+        int width;
+        int height;
+        /// \brief Tells if each cell is a wall, in row-major order.
+        std::vector<bool> isWall;
+        /// \brief Tells if each cell is dead, in row-major order.
+        std::vector<bool> isDead;
+        /// \brief Tells if each cell is frozen, in row-major order.
+        std::vector<bool> isFrozen;
+        /// \brief Tells if each cell holds a goal, in row-major order.
+        std::vector<bool> isGoal;
+    };
+}
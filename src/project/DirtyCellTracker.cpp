@@ -0,0 +1,114 @@
+#include "DirtyCellTracker.h"
+
+#include <memory>
+#include <vector>
+#include "Board.h"
+#include "Contracts.h"
+#include "Gate.h"
+#include "IBoardObserver.h"
+#include "PieceBase.h"
+#include "Vector2.h"
+
+using namespace Arcade;
+
+/// \brief Creates a new tracker that watches the given board. All
+/// cells start out clean.
+/// \pre require(Scene != nullptr);
+/// \post ensure(this->CheckInvariants());
+DirtyCellTracker::DirtyCellTracker(std::shared_ptr<Board> Scene)
+    : scene(Scene)
+{
+    require(Scene != nullptr);
+    this->isDirty.assign(Scene->GetWidth() * Scene->GetHeight(), false);
+    this->scene->Subscribe(this);
+    ensure(this->CheckInvariants());
+}
+
+/// \brief Stops watching the tracker's board.
+DirtyCellTracker::~DirtyCellTracker()
+{
+    this->scene->Unsubscribe(this);
+}
+
+/// \brief Checks if this type's invariants are being respected.
+/// A boolean value is returned that indicates whether this is
+/// indeed the case. This method is publically visible, and can
+/// be used to verify an instance's state.
+bool DirtyCellTracker::CheckInvariants() const
+{
+    if (!this->isCheckingInvariants)
+    {
+        this->isCheckingInvariants = true;
+        bool result = this->scene != nullptr &&
+                      (int)this->isDirty.size() == this->scene->GetWidth() * this->scene->GetHeight();
+        this->isCheckingInvariants = false;
+        return result;
+    }
+    return true;
+}
+
+/// \brief Marks every cell as clean.
+/// \pre require(this->CheckInvariants());
+/// \post ensure(this->GetDirtyCells().empty());
+void DirtyCellTracker::Clear()
+{
+    require(this->CheckInvariants());
+    for (auto& item : this->dirtyCells)
+        this->isDirty[item.Y * this->scene->GetWidth() + item.X] = false;
+    this->dirtyCells.clear();
+    ensure(this->GetDirtyCells().empty());
+}
+
+/// \brief Gets the positions of all cells that have changed since
+/// the tracker was last cleared, in the order in which they
+/// first changed. Every position occurs at most once.
+/// \pre require(this->CheckInvariants());
+const std::vector<Vector2<int>>& DirtyCellTracker::GetDirtyCells() const
+{
+    require(this->CheckInvariants());
+    return this->dirtyCells;
+}
+
+/// \brief Gets the board that this tracker watches.
+/// \pre require(this->CheckInvariants());
+std::shared_ptr<Board> DirtyCellTracker::GetScene() const
+{
+    require(this->CheckInvariants());
+    return this->scene;
+}
+
+/// \brief Marks the given piece's cell as dirty.
+void DirtyCellTracker::PieceAdded(const Board& /*Scene*/, const std::shared_ptr<PieceBase>& Piece)
+{
+    this->MarkDirty(Piece->GetPosition());
+}
+
+/// \brief Marks the given piece's cell as dirty.
+void DirtyCellTracker::PieceRemoved(const Board& /*Scene*/, const std::shared_ptr<PieceBase>& Piece)
+{
+    this->MarkDirty(Piece->GetPosition());
+}
+
+/// \brief Marks the given source and target cells as dirty.
+void DirtyCellTracker::PieceMoved(const Board& /*Scene*/, const std::shared_ptr<PieceBase>& /*Piece*/, Vector2<int> Source, Vector2<int> Target)
+{
+    this->MarkDirty(Source);
+    this->MarkDirty(Target);
+}
+
+/// \brief Marks the given gate's cell as dirty.
+void DirtyCellTracker::GateToggled(const Board& /*Scene*/, const std::shared_ptr<Gate>& Piece, bool /*IsOpened*/)
+{
+    this->MarkDirty(Piece->GetPosition());
+}
+
+/// \brief Marks the cell at the given position as dirty.
+void DirtyCellTracker::MarkDirty(Vector2<int> Position)
+{
+    int index = Position.Y * this->scene->GetWidth() + Position.X;
+    if (!this->isDirty[index])
+    {
+        this->isDirty[index] = true;
+        this->dirtyCells.push_back(Position);
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "Board.h"
+#include "Contracts.h"
+#include "IBoardObserver.h"
+#include "Vector2.h"
+
+namespace Arcade
+{
+    /// \brief Describes a board observer that keeps track of the cells
+    /// whose contents have changed since it was last cleared.
+    /// Renderers can use a tracker to redraw only those cells.
+    class DirtyCellTracker : public IBoardObserver
+    {
+    public:
+        /// \brief Creates a new tracker that watches the given board. All
+        /// cells start out clean.
+        /// \pre require(Scene != nullptr);
+        /// \post ensure(this->CheckInvariants());
+        DirtyCellTracker(std::shared_ptr<Board> Scene);
+
+        /// \brief Stops watching the tracker's board.
+        ~DirtyCellTracker();
+
+        DirtyCellTracker(const DirtyCellTracker& Other) = delete;
+        DirtyCellTracker& operator=(const DirtyCellTracker& Other) = delete;
+
+        /// \brief Checks if this type's invariants are being respected.
+        /// A boolean value is returned that indicates whether this is
+        /// indeed the case. This method is publically visible, and can
+        /// be used to verify an instance's state.
+        bool CheckInvariants() const;
+
+        /// \brief Marks every cell as clean.
+        /// \pre require(this->CheckInvariants());
+        /// \post ensure(this->GetDirtyCells().empty());
+        void Clear();
+
+        /// \brief Gets the positions of all cells that have changed since
+        /// the tracker was last cleared, in the order in which they
+        /// first changed. Every position occurs at most once.
+        /// \pre require(this->CheckInvariants());
+        const std::vector<Vector2<int>>& GetDirtyCells() const;
+
+        /// \brief Gets the board that this tracker watches.
+        /// \pre require(this->CheckInvariants());
+        std::shared_ptr<Board> GetScene() const;
+
+        /// \brief Marks the given piece's cell as dirty.
+        void PieceAdded(const Board& Scene, const std::shared_ptr<PieceBase>& Piece) override;
+
+        /// \brief Marks the given piece's cell as dirty.
+        void PieceRemoved(const Board& Scene, const std::shared_ptr<PieceBase>& Piece) override;
+
+        /// \brief Marks the given source and target cells as dirty.
+        void PieceMoved(const Board& Scene, const std::shared_ptr<PieceBase>& Piece, Vector2<int> Source, Vector2<int> Target) override;
+
+        /// \brief Marks the given gate's cell as dirty.
+        void GateToggled(const Board& Scene, const std::shared_ptr<Gate>& Piece, bool IsOpened) override;
+    private:
+        /// \brief Marks the cell at the given position as dirty.
+        void MarkDirty(Vector2<int> Position);
+
+        mutable bool isCheckingInvariants = false;
+        std::shared_ptr<Board> scene;
+        std::vector<Vector2<int>> dirtyCells;
+        /// \brief Tells if each cell is dirty, in row-major order.
+        std::vector<bool> isDirty;
+    };
+}
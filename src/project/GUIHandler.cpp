@@ -11,28 +11,28 @@
 using namespace Arcade;
 
 /// Creates a new GUI handler.
-/// \pre require(display != nullptr);
+/// \pre require_cheap(display != nullptr);
 GUIHandler::GUIHandler(Fl_Text_Display* display)
 	: display(display)
 {
-	require(display != nullptr);
+	require_cheap(display != nullptr);
 }
 
 /// \brief Applies a command to the board.
-/// \pre require(Command != nullptr);
-/// \pre require(this->GetIsInitialized());
+/// \pre require_cheap(Command != nullptr);
+/// \pre require_cheap(this->GetIsInitialized());
 void GUIHandler::Apply(std::shared_ptr<ICommand<std::shared_ptr<Board>>> Command)
 {
-	require(Command != nullptr);
-	require(this->GetIsInitialized());
+	require_cheap(Command != nullptr);
+	require_cheap(this->GetIsInitialized());
 	this->handler->Apply(Command);
 }
 
 /// \brief Displays the board.
-/// \pre require(this->GetIsInitialized());
+/// \pre require_cheap(this->GetIsInitialized());
 void GUIHandler::Display()
 {
-	require(this->GetIsInitialized());
+	require_cheap(this->GetIsInitialized());
 	this->handler->Display();
 
 	Flush();
@@ -40,10 +40,10 @@ void GUIHandler::Display()
 
 /// \brief Initializes the UI handler and displays the board right
 /// away.
-/// \pre require(Value != nullptr);
+/// \pre require_cheap(Value != nullptr);
 void GUIHandler::Initialize(std::shared_ptr<Board> Value)
 {
-	require(Value != nullptr);
+	require_cheap(Value != nullptr);
 	this->outputStream.str("");
 	this->outputStream.clear();
 	this->handler = std::make_shared<ASCIIArtUIHandler>(&outputStream);
@@ -55,7 +55,7 @@ void GUIHandler::Initialize(std::shared_ptr<Board> Value)
 	}
 	else
 	{
-		this->mainActor = players[0];
+		this->mainActor = players.front();
 	}
 	Flush();
 }
@@ -68,21 +68,21 @@ bool GUIHandler::GetIsInitialized() const
 }
 
 /// \brief Gets the GUI handler's board.
-/// \pre require(this->GetIsInitialized());
-/// \post ensure(result != nullptr);
+/// \pre require_cheap(this->GetIsInitialized());
+/// \post ensure_cheap(result != nullptr);
 std::shared_ptr<Board> GUIHandler::GetScene() const
 {
-	require(this->GetIsInitialized());
+	require_cheap(this->GetIsInitialized());
 	auto result = this->handler->GetScene();
-	ensure(result != nullptr);
+	ensure_cheap(result != nullptr);
 	return result;
 }
 
 /// \brief Gets the GUI handler's main actor.
-/// \pre require(this->GetIsInitialized());
+/// \pre require_cheap(this->GetIsInitialized());
 std::shared_ptr<Actor> GUIHandler::GetMainActor() const
 {
-	require(this->GetIsInitialized());
+	require_cheap(this->GetIsInitialized());
 	return mainActor;
 }
 
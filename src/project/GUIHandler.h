@@ -15,21 +15,21 @@ namespace Arcade
 	{
 	public:
 		/// Creates a new GUI handler.
-		/// \pre require(display != nullptr);
+		/// \pre require_cheap(display != nullptr);
 		GUIHandler(Fl_Text_Display* display);
 
 		/// \brief Applies a command to the board.
-		/// \pre require(Command != nullptr);
-		/// \pre require(this->GetIsInitialized());
+		/// \pre require_cheap(Command != nullptr);
+		/// \pre require_cheap(this->GetIsInitialized());
 		void Apply(std::shared_ptr<ICommand<std::shared_ptr<Board>>> Command) override;
 
 		/// \brief Displays the board.
-		/// \pre require(this->GetIsInitialized());
+		/// \pre require_cheap(this->GetIsInitialized());
 		void Display() override;
 
 		/// \brief Initializes the UI handler and displays the board right
 		/// away.
-		/// \pre require(Value != nullptr);
+		/// \pre require_cheap(Value != nullptr);
 		void Initialize(std::shared_ptr<Board> Value) override;
 
 		/// \brief Gets a boolean flag that indicates whether the UI handler
@@ -37,15 +37,15 @@ namespace Arcade
 		bool GetIsInitialized() const override;
 
 		/// \brief Gets the GUI handler's board.
-		/// \pre require(this->GetIsInitialized());
+		/// \pre require_cheap(this->GetIsInitialized());
 		std::shared_ptr<Board> GetScene() const;
 		
 		/// \brief Gets the GUI handler's main actor.
-		/// \pre require(this->GetIsInitialized());
+		/// \pre require_cheap(this->GetIsInitialized());
 		std::shared_ptr<Actor> GetMainActor() const;
 
 		/// \brief Gets a boolean value that tells if the game has ended.
-		/// \pre require(this->GetIsInitialized());
+		/// \pre require_cheap(this->GetIsInitialized());
 		bool HasEnded() const;
 
 	private:
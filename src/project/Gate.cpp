@@ -9,31 +9,48 @@
 #include "Contracts.h"
 #include "Obstacle.h"
 #include "PieceBase.h"
+#include "Symbol.h"
 #include "Vector2.h"
 
 using namespace Arcade;
 
 /// \brief Creates a new gate piece at the given position and with
 /// the given associated buttons.
-/// \post ensure(this->CheckInvariants());
-Gate::Gate(Vector2<int> Position, std::string Name, stdx::ArraySlice<std::shared_ptr<Button>> AssociatedButtons)
+/// \post ensure_linear(this->CheckInvariants());
+Gate::Gate(Vector2<int> Position, Symbol Name, stdx::ArraySlice<std::shared_ptr<Button>> AssociatedButtons)
 {
     this->SetPosition(Position);
     this->SetName(Name);
     this->SetAssociatedButtons(AssociatedButtons);
     this->SetObstacleType("poort");
     this->SetMovable(false);
-    ensure(this->CheckInvariants());
+    ensure_linear(this->CheckInvariants());
+}
+
+/// \brief Creates a copy of this piece that shares its
+/// identifier.
+std::shared_ptr<PieceBase> Gate::Clone() const
+{
+    return std::make_shared<Gate>(*this);
 }
 
 /// \brief Figures out if all of this gate's buttons are in the given
 /// board.
-/// \pre require(this->CheckInvariants());
+/// \pre require_linear(this->CheckInvariants());
 bool Gate::CheckButtonsInBoard(std::shared_ptr<Board> Scene) const
 {
-    require(this->CheckInvariants());
+    require_linear(this->CheckInvariants());
+    return this->CheckButtonsInBoard(*Scene);
+}
+
+/// \brief Figures out if all of this gate's buttons are in the given
+/// board.
+/// \pre require_linear(this->CheckInvariants());
+bool Gate::CheckButtonsInBoard(const Board& Scene) const
+{
+    require_linear(this->CheckInvariants());
     for (auto& item : this->GetAssociatedButtons())
-        if (!Scene->HasPiece(item))
+        if (!Scene.GetHandle(*item).IsValid())
             return false;
 
     return true;
@@ -43,15 +60,15 @@ bool Gate::CheckButtonsInBoard(std::shared_ptr<Board> Scene) const
 /// A boolean value is returned that indicates whether this is
 /// indeed the case. This method is publically visible, and can
 /// be used to verify an instance's state.
+/// \remark Pieces may be shared by boards that other threads are
+/// reading, so this method reads fields directly instead of going
+/// through accessors whose contracts would call it again.
 bool Gate::CheckInvariants() const
 {
-    if (!this->isCheckingInvariants)
-    {
-        this->isCheckingInvariants = true;
-        bool result = !this->OverlapsWithButtons();
-        this->isCheckingInvariants = false;
-        return result;
-    }
+    for (auto& item : this->AssociatedButtons_value)
+        if (item->GetPosition() == this->GetPosition())
+            return false;
+
     return true;
 }
 
@@ -59,28 +76,28 @@ bool Gate::CheckInvariants() const
 /// A boolean is returned that indicates whether another piece
 /// is free to move onto this piece's (previous) position or
 /// not.
-/// \pre require(Event.GetStaticPiece().get() == this);
-/// \pre require(this->CheckButtonsInBoard(Event.GetScene()));
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Event.GetStaticPiece() == this);
+/// \pre require_linear(this->CheckButtonsInBoard(*Event.GetScene()));
+/// \pre require_linear(this->CheckInvariants());
+/// \post ensure_linear(this->CheckInvariants());
 bool Gate::Collide(Collision Event)
 {
-    require(Event.GetStaticPiece().get() == this);
-    require(this->CheckButtonsInBoard(Event.GetScene()));
-    require(this->CheckInvariants());
-    bool result = this->IsOpened(Event.GetScene());
-    ensure(this->CheckInvariants());
+    require_cheap(Event.GetStaticPiece() == this);
+    require_linear(this->CheckButtonsInBoard(*Event.GetScene()));
+    require_linear(this->CheckInvariants());
+    bool result = this->IsOpened(*Event.GetScene());
+    ensure_linear(this->CheckInvariants());
     return result;
 }
 
 /// \brief Determines whether the given button is one of this gate's
 /// associated buttons.
-/// \pre require(this->CheckInvariants());
+/// \pre require_linear(this->CheckInvariants());
 bool Gate::IsAssociatedButton(const Button* Piece) const
 {
-    require(this->CheckInvariants());
+    require_linear(this->CheckInvariants());
     for (auto& item : this->GetAssociatedButtons())
-        if (item.get() == Piece)
+        if (item->GetId() == Piece->GetId())
             return true;
 
     return false;
@@ -88,14 +105,31 @@ bool Gate::IsAssociatedButton(const Button* Piece) const
 
 /// \brief Figures out whether the gate is currently in an opened
 /// state.
-/// \pre require(this->CheckButtonsInBoard(Scene));
-/// \pre require(this->CheckInvariants());
+/// \pre require_linear(this->CheckButtonsInBoard(Scene));
+/// \pre require_linear(this->CheckInvariants());
 bool Gate::IsOpened(std::shared_ptr<Board> Scene) const
 {
-    require(this->CheckButtonsInBoard(Scene));
-    require(this->CheckInvariants());
+    require_linear(this->CheckButtonsInBoard(Scene));
+    require_linear(this->CheckInvariants());
+    return this->IsOpened(*Scene);
+}
+
+/// \brief Figures out whether the gate is currently in an opened
+/// state.
+/// \pre require_linear(this->CheckButtonsInBoard(Scene));
+/// \pre require_linear(this->CheckInvariants());
+bool Gate::IsOpened(const Board& Scene) const
+{
+    require_linear(this->CheckButtonsInBoard(Scene));
+    require_linear(this->CheckInvariants());
+    int pressed = Scene.GetPressedButtonCount(*this);
+    if (pressed >= 0)
+        return pressed > 0;
+
+    // The gate is not on the board, so the board does not keep
+    // track of its buttons.
     for (auto& item : this->GetAssociatedButtons())
-        if (!Scene->GetItem(item->GetPosition())->GetIsTerrain())
+        if (!Scene.GetItem(item->GetPosition())->GetIsTerrain())
             return true;
 
     return false;
@@ -103,10 +137,10 @@ bool Gate::IsOpened(std::shared_ptr<Board> Scene) const
 
 /// \brief Figures out whether this gate overlaps with its own
 /// buttons.
-/// \pre require(this->CheckInvariants());
+/// \pre require_linear(this->CheckInvariants());
 bool Gate::OverlapsWithButtons() const
 {
-    require(this->CheckInvariants());
+    require_linear(this->CheckInvariants());
     for (auto& item : this->GetAssociatedButtons())
         if (item->GetPosition() == this->GetPosition())
             return true;
@@ -115,10 +149,10 @@ bool Gate::OverlapsWithButtons() const
 }
 
 /// \brief Gets this gate's associated buttons.
-/// \pre require(this->CheckInvariants());
+/// \pre require_linear(this->CheckInvariants());
 stdx::ArraySlice<std::shared_ptr<Button>> Gate::GetAssociatedButtons() const
 {
-    require(this->CheckInvariants());
+    require_linear(this->CheckInvariants());
     return this->AssociatedButtons_value;
 }
 
@@ -131,23 +165,23 @@ void Gate::SetAssociatedButtons(stdx::ArraySlice<std::shared_ptr<Button>> value)
 /// \brief Gets a boolean value that indicates whether this piece is a
 /// terrain piece, i.e. it can share its position with another
 /// piece.
-/// \pre require(this->CheckInvariants());
+/// \pre require_linear(this->CheckInvariants());
 bool Gate::GetIsTerrain() const
 {
-    require(this->CheckInvariants());
+    require_linear(this->CheckInvariants());
     return true;
 }
 
 /// \brief Sets the gate's name.
-void Gate::SetName(std::string value)
+void Gate::SetName(Symbol value)
 {
     this->Name_value = value;
 }
 
 /// \brief Gets the gate's name.
-/// \pre require(this->CheckInvariants());
-std::string Gate::GetName() const
+/// \pre require_linear(this->CheckInvariants());
+Symbol Gate::GetName() const
 {
-    require(this->CheckInvariants());
+    require_linear(this->CheckInvariants());
     return this->Name_value;
 }
\ No newline at end of file
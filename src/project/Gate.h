@@ -6,6 +6,7 @@
 #include "Collision.h"
 #include "Contracts.h"
 #include "Obstacle.h"
+#include "Symbol.h"
 #include "Vector2.h"
 
 namespace Arcade
@@ -20,78 +21,88 @@ namespace Arcade
     public:
         /// \brief Creates a new gate piece at the given position and with
         /// the given associated buttons.
-        /// \post ensure(this->CheckInvariants());
-        Gate(Vector2<int> Position, std::string Name, stdx::ArraySlice<std::shared_ptr<Button>> AssociatedButtons);
+        /// \post ensure_linear(this->CheckInvariants());
+        Gate(Vector2<int> Position, Symbol Name, stdx::ArraySlice<std::shared_ptr<Button>> AssociatedButtons);
+
+        /// \brief Creates a copy of this piece that shares its
+        /// identifier.
+        std::shared_ptr<PieceBase> Clone() const override;
 
         /// \brief Figures out if all of this gate's buttons are in the given
         /// board.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_linear(this->CheckInvariants());
         bool CheckButtonsInBoard(std::shared_ptr<Board> Scene) const;
 
+        /// \brief Figures out if all of this gate's buttons are in the given
+        /// board.
+        /// \pre require_linear(this->CheckInvariants());
+        bool CheckButtonsInBoard(const Board& Scene) const;
+
         /// \brief Checks if this type's invariants are being respected.
         /// A boolean value is returned that indicates whether this is
         /// indeed the case. This method is publically visible, and can
         /// be used to verify an instance's state.
+        /// \remark Pieces may be shared by boards that other threads are
+        /// reading, so this method reads fields directly instead of going
+        /// through accessors whose contracts would call it again.
         bool CheckInvariants() const;
         // {
-        //     if (!this->isCheckingInvariants)
-        //     {
-        //         this->isCheckingInvariants = true;
-        //         bool result = !this->OverlapsWithButtons();
-        //         this->isCheckingInvariants = false;
-        //         return result;
-        //     }
-        //     return true;
+        //     return !this->OverlapsWithButtons();
         // }
 
         /// \brief Has a piece collide with this piece.
         /// A boolean is returned that indicates whether another piece
         /// is free to move onto this piece's (previous) position or
         /// not.
-        /// \pre require(Event.GetStaticPiece().get() == this);
-        /// \pre require(this->CheckButtonsInBoard(Event.GetScene()));
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Event.GetStaticPiece() == this);
+        /// \pre require_linear(this->CheckButtonsInBoard(*Event.GetScene()));
+        /// \pre require_linear(this->CheckInvariants());
+        /// \post ensure_linear(this->CheckInvariants());
         bool Collide(Collision Event) override;
 
         /// \brief Gets this gate's associated buttons.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_linear(this->CheckInvariants());
         stdx::ArraySlice<std::shared_ptr<Button>> GetAssociatedButtons() const;
 
         /// \brief Gets the gate's name.
-        /// \pre require(this->CheckInvariants());
-        std::string GetName() const;
+        /// \pre require_linear(this->CheckInvariants());
+        Symbol GetName() const;
 
         /// \brief Determines whether the given button is one of this gate's
         /// associated buttons.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_linear(this->CheckInvariants());
         bool IsAssociatedButton(const Button* Piece) const;
 
         /// \brief Figures out whether the gate is currently in an opened
         /// state.
-        /// \pre require(this->CheckButtonsInBoard(Scene));
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_linear(this->CheckButtonsInBoard(Scene));
+        /// \pre require_linear(this->CheckInvariants());
         bool IsOpened(std::shared_ptr<Board> Scene) const;
 
+        /// \brief Figures out whether the gate is currently in an opened
+        /// state.
+        /// \pre require_linear(this->CheckButtonsInBoard(Scene));
+        /// \pre require_linear(this->CheckInvariants());
+        bool IsOpened(const Board& Scene) const;
+
         /// \brief Figures out whether this gate overlaps with its own
         /// buttons.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_linear(this->CheckInvariants());
         bool OverlapsWithButtons() const;
 
         /// \brief Gets a boolean value that indicates whether this piece is a
         /// terrain piece, i.e. it can share its position with another
         /// piece.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_linear(this->CheckInvariants());
         bool GetIsTerrain() const override;
     private:
         /// \brief Sets this gate's associated buttons.
         void SetAssociatedButtons(stdx::ArraySlice<std::shared_ptr<Button>> value);
 
         /// \brief Sets the gate's name.
-        void SetName(std::string value);
+        void SetName(Symbol value);
 
         stdx::ArraySlice<std::shared_ptr<Button>> AssociatedButtons_value;
-        mutable bool isCheckingInvariants = false;
-        std::string Name_value;
+        Symbol Name_value;
     };
 }
\ No newline at end of file
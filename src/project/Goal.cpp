@@ -19,14 +19,21 @@ Goal::Goal(Vector2<int> Position)
     this->SetMovable(false);
 }
 
+/// \brief Creates a copy of this piece that shares its
+/// identifier.
+std::shared_ptr<PieceBase> Goal::Clone() const
+{
+    return std::make_shared<Goal>(*this);
+}
+
 /// \brief Has a piece collide with this piece.
 /// A boolean is returned that indicates whether another piece
 /// is free to move onto this piece's (previous) position or
 /// not.
-/// \pre require(Event.GetStaticPiece().get() == this);
+/// \pre require(Event.GetStaticPiece() == this);
 bool Goal::Collide(Collision Event)
 {
-    require(Event.GetStaticPiece().get() == this);
+    require(Event.GetStaticPiece() == this);
     return true;
 }
 
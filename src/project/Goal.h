@@ -15,11 +15,15 @@ namespace Arcade
         /// \brief Creates a new goal piece at the given position.
         Goal(Vector2<int> Position);
 
+        /// \brief Creates a copy of this piece that shares its
+        /// identifier.
+        std::shared_ptr<PieceBase> Clone() const override;
+
         /// \brief Has a piece collide with this piece.
         /// A boolean is returned that indicates whether another piece
         /// is free to move onto this piece's (previous) position or
         /// not.
-        /// \pre require(Event.GetStaticPiece().get() == this);
+        /// \pre require(Event.GetStaticPiece() == this);
         bool Collide(Collision Event) override;
 
         /// \brief Figures out whether the given player is standing on this
@@ -13,6 +13,7 @@
 #include "Obstacle.h"
 #include "PieceBase.h"
 #include "Player.h"
+#include "Symbol.h"
 #include "Trap.h"
 #include "UIHandlerBase.h"
 #include "Water.h"
@@ -20,23 +21,23 @@
 using namespace Arcade;
 
 /// \brief Creates a new HTML UI handler.
-/// \pre require(outputStream != nullptr);
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(outputStream != nullptr);
+/// \post ensure_cheap(this->CheckInvariants());
 HtmlUIHandler::HtmlUIHandler(std::ostream* outputStream)
     : UIHandlerBase(outputStream)
 {
-    require(outputStream != nullptr);
-    ensure(this->CheckInvariants());
+    require_cheap(outputStream != nullptr);
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the board.
-/// \pre require(this->GetIsInitialized());
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->GetIsInitialized());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void HtmlUIHandler::Display()
 {
-    require(this->GetIsInitialized());
-    require(this->CheckInvariants());
+    require_cheap(this->GetIsInitialized());
+    require_cheap(this->CheckInvariants());
     *this->outputStream << "<!DOCTYPE html>" << "\n";
     *this->outputStream << "<html>" << "\n";
     *this->outputStream << "<head>" << "\n";
@@ -72,7 +73,7 @@ void HtmlUIHandler::Display()
     *this->outputStream << "</table>" << "\n";
     *this->outputStream << "</body>" << "\n";
     *this->outputStream << "</html>" << "\n";
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given piece.
@@ -103,10 +104,12 @@ std::string HtmlUIHandler::showPiece(std::shared_ptr<PieceBase> piece)
     else if (stdx::isinstance<Obstacle>(piece))
     {
         auto obs = std::dynamic_pointer_cast<Obstacle>(piece);
+        static const Symbol barrel("ton");
+        static const Symbol wall("muur");
         std::string name;
-        if (obs->GetObstacleType() == "ton")
+        if (obs->GetObstacleType() == barrel)
             name = "O";
-        else if (obs->GetObstacleType() == "muur")
+        else if (obs->GetObstacleType() == wall)
             name = "#";
         else
             name = "?";
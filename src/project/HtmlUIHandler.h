@@ -13,14 +13,14 @@ namespace Arcade
     {
     public:
         /// \brief Creates a new HTML UI handler.
-        /// \pre require(outputStream != nullptr);
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(outputStream != nullptr);
+        /// \post ensure_cheap(this->CheckInvariants());
         HtmlUIHandler(std::ostream* outputStream);
 
         /// \brief Displays the board.
-        /// \pre require(this->GetIsInitialized());
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->GetIsInitialized());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void Display() override;
     private:
         /// \brief Displays the given piece.
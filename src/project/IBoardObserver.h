@@ -0,0 +1,36 @@
+#pragma once
+#include <memory>
+#include "Vector2.h"
+
+namespace Arcade
+{
+    class Board;
+    class Gate;
+    class PieceBase;
+
+    /// \brief Defines a common interface for objects that want to be
+    /// told about changes to a board, such as renderers and caches.
+    /// Events are sent after the board has been updated, so an
+    /// observer may query the board while handling an event.
+    /// \remark Observers must not modify the board they observe from
+    /// within an event handler.
+    struct IBoardObserver
+    {
+        /// \brief Tells the observer that a piece has been added to the
+        /// given board.
+        virtual void PieceAdded(const Board& Scene, const std::shared_ptr<PieceBase>& Piece) = 0;
+
+        /// \brief Tells the observer that a piece has been removed from
+        /// the given board.
+        virtual void PieceRemoved(const Board& Scene, const std::shared_ptr<PieceBase>& Piece) = 0;
+
+        /// \brief Tells the observer that a piece on the given board has
+        /// moved from the given source position to the given target
+        /// position.
+        virtual void PieceMoved(const Board& Scene, const std::shared_ptr<PieceBase>& Piece, Vector2<int> Source, Vector2<int> Target) = 0;
+
+        /// \brief Tells the observer that a gate on the given board has
+        /// been opened or closed.
+        virtual void GateToggled(const Board& Scene, const std::shared_ptr<Gate>& Piece, bool IsOpened) = 0;
+    };
+}
@@ -0,0 +1,72 @@
+#include "JournaledCommand.h"
+
+#include <memory>
+#include "Board.h"
+#include "BoardJournal.h"
+#include "Contracts.h"
+#include "ICommand.h"
+
+using namespace Arcade;
+
+/// \brief Creates a command that executes the given command
+/// through the given journal.
+/// \pre require_cheap(Journal != nullptr);
+/// \pre require_cheap(Command != nullptr);
+/// \post ensure_cheap(this->CheckInvariants());
+JournaledCommand::JournaledCommand(std::shared_ptr<BoardJournal> Journal, std::shared_ptr<ICommand<std::shared_ptr<Board>>> Command)
+    : journal(Journal), command(Command)
+{
+    require_cheap(Journal != nullptr);
+    require_cheap(Command != nullptr);
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Checks if this type's invariants are being respected.
+/// A boolean value is returned that indicates whether this is
+/// indeed the case. This method is publically visible, and can
+/// be used to verify an instance's state.
+bool JournaledCommand::CheckInvariants() const
+{
+    if (!this->isCheckingInvariants)
+    {
+        this->isCheckingInvariants = true;
+        bool result = this->journal != nullptr && this->command != nullptr;
+        this->isCheckingInvariants = false;
+        return result;
+    }
+    return true;
+}
+
+/// \brief Executes the inner command and returns a boolean that
+/// tells if the operation has completed successfully. The
+/// command is only recorded if the given board is the
+/// journal's board.
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
+bool JournaledCommand::Execute(std::shared_ptr<Board> TargetBoard)
+{
+    require_cheap(this->CheckInvariants());
+    bool result;
+    if (TargetBoard == this->journal->GetScene())
+        result = this->journal->Execute(this->command);
+    else
+        result = this->command->Execute(TargetBoard);
+    ensure_cheap(this->CheckInvariants());
+    return result;
+}
+
+/// \brief Gets the command that this command executes.
+/// \pre require_cheap(this->CheckInvariants());
+std::shared_ptr<ICommand<std::shared_ptr<Board>>> JournaledCommand::GetCommand() const
+{
+    require_cheap(this->CheckInvariants());
+    return this->command;
+}
+
+/// \brief Gets the journal that this command records changes in.
+/// \pre require_cheap(this->CheckInvariants());
+std::shared_ptr<BoardJournal> JournaledCommand::GetJournal() const
+{
+    require_cheap(this->CheckInvariants());
+    return this->journal;
+}
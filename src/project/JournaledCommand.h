@@ -0,0 +1,48 @@
+#pragma once
+#include <memory>
+#include "Board.h"
+#include "BoardJournal.h"
+#include "Contracts.h"
+#include "ICommand.h"
+
+namespace Arcade
+{
+    /// \brief Represents a command that executes another command through
+    /// a journal, so that its changes can be undone.
+    class JournaledCommand : public virtual ICommand<std::shared_ptr<Board>>
+    {
+    public:
+        /// \brief Creates a command that executes the given command
+        /// through the given journal.
+        /// \pre require_cheap(Journal != nullptr);
+        /// \pre require_cheap(Command != nullptr);
+        /// \post ensure_cheap(this->CheckInvariants());
+        JournaledCommand(std::shared_ptr<BoardJournal> Journal, std::shared_ptr<ICommand<std::shared_ptr<Board>>> Command);
+
+        /// \brief Checks if this type's invariants are being respected.
+        /// A boolean value is returned that indicates whether this is
+        /// indeed the case. This method is publically visible, and can
+        /// be used to verify an instance's state.
+        bool CheckInvariants() const;
+
+        /// \brief Executes the inner command and returns a boolean that
+        /// tells if the operation has completed successfully. The
+        /// command is only recorded if the given board is the
+        /// journal's board.
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
+        bool Execute(std::shared_ptr<Board> TargetBoard) override;
+
+        /// \brief Gets the command that this command executes.
+        /// \pre require_cheap(this->CheckInvariants());
+        std::shared_ptr<ICommand<std::shared_ptr<Board>>> GetCommand() const;
+
+        /// \brief Gets the journal that this command records changes in.
+        /// \pre require_cheap(this->CheckInvariants());
+        std::shared_ptr<BoardJournal> GetJournal() const;
+    private:
+        mutable bool isCheckingInvariants = false;
+        std::shared_ptr<BoardJournal> journal;
+        std::shared_ptr<ICommand<std::shared_ptr<Board>>> command;
+    };
+}
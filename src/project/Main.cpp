@@ -1,3 +1,5 @@
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <functional>
 #include <string>
@@ -18,48 +20,16 @@
 #include "LambdaParser.h"
 #include "EmptyCommand.h"
 #include "CompositeCommand.h"
+#include "BatchRunner.h"
+#include "BoardJournal.h"
+#include "CheckpointedReplay.h"
+#include "JournaledCommand.h"
+#include "SaveCommand.h"
+#include "Solver.h"
+#include "WorkStealingPool.h"
 
 using namespace Arcade;
 
-void WriteToFile(UIHandlerBase& Handler, std::string FilePath, std::function<void(UIHandlerBase&)> Function)
-{
-	std::string path(FilePath);
-
-	if (path.size() == 0) // Use console as output
-	{
-		Handler.SetOutputStream(&std::cout);
-		Function(Handler);
-		std::cout << std::endl << std::endl;
-	}
-	else
-	{
-		std::ofstream target;
-		target.open(FilePath);
-		if (target.is_open())
-		{
-			if (stdx::isinstance<TextUIHandler>(Handler))
-			{
-				target << "Bestand: " << FilePath << std::endl << std::endl;
-			}
-			Handler.SetOutputStream(&target);
-		}
-		else
-		{
-			std::cout << "Het bestand '" << FilePath << "' kon niet geopend worden." << std::endl << std::endl;
-			Handler.SetOutputStream(&std::cout);
-		}
-		Function(Handler);
-		if (target.is_open())
-		{
-			target.close();
-		}
-		else
-		{
-			std::cout << std::endl << std::endl;
-		}
-	}
-}
-
 template<typename T>
 T GetArgument(int Index, T Default, int argc, const char* argv[]);
 
@@ -83,21 +53,22 @@ void PrintUsage(const char* Name)
         << " * " << Name << " ascii Board.xml Commands.xml [BoardOutput.txt [SlideshowOutput.txt [slideshow (true|false)]]]" << std::endl
         << " * " << Name << " cg Board.xml Commands.xml [BoardOutput.ini [SlideshowOutput.ini [slideshow (true|false)]]]" << std::endl
         << " * " << Name << " xml Board.xml Commands.xml [InitialBoardOutput.xml ResultBoardOutput.xml]" << std::endl
-		<< " * " << Name << " interactive Board.xml" << std::endl;
+		<< " * " << Name << " interactive Board.xml" << std::endl
+		<< " * " << Name << " batch Manifest.txt [Results.txt [threads]]" << std::endl
+		<< " * " << Name << " simulate Board.xml Commands.xml [(json|csv)]" << std::endl
+		<< " * " << Name << " solve Board.xml [Commands.xml [(astar|bfs|parallel) [max-states [threads]]]]" << std::endl;
 }
 
-std::shared_ptr<IParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>> CreateSaveCommandParser(std::shared_ptr<Board> Scene, std::function<std::shared_ptr<UIHandlerBase>()> OutputHandler)
+/// \brief Parses the number of actions that an "undo" or "redo" action
+/// takes back or performs again. If the given value is not a
+/// positive number, -1 is returned.
+int ParseActionCount(const std::string& Value)
 {
-	return Arcade::LambdaParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>::make_shared([=](std::string val)
-	{
-		auto handler = OutputHandler();
-		WriteToFile(*handler, val, [=](UIHandlerBase& h)
-		{
-			h.Initialize(Scene);
-		});
-
-		return Arcade::EmptyCommand<std::shared_ptr<Board>>::GetInstance();
-	});
+	char* end;
+	long result = std::strtol(Value.c_str(), &end, 10);
+	if (Value.empty() || *end != '\0' || result <= 0 || result > 1000000)
+		return -1;
+	return (int)result;
 }
 
 int StartInteractive(int argc, const char* argv[])
@@ -121,19 +92,68 @@ int StartInteractive(int argc, const char* argv[])
 		return 1;
 	}
 
-	std::shared_ptr<Player> mainPlayer = players[0];
+	std::shared_ptr<Player> mainPlayer = players.front();
 
 	CommandLineUI handler(&std::cin, std::make_shared<ASCIIArtUIHandler>(&std::cout), mainPlayer);
-	auto moveParser = Arcade::LambdaParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>::make_shared<CommandLineUI>(handler, &CommandLineUI::ParseMove);
+
+	// Moves and attacks are recorded in a journal, so "undo N" and
+	// "redo N" can take them back and perform them again.
+	auto journal = std::make_shared<BoardJournal>(b);
+	auto moveParser = Arcade::LambdaParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>::make_shared([&](std::string arg) -> std::shared_ptr<Arcade::ICommand<std::shared_ptr<Board>>>
+	{
+		return std::make_shared<JournaledCommand>(journal, handler.ParseMove(arg));
+	});
 	handler.AddActionParser("m", moveParser);
-	auto attackParser = Arcade::LambdaParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>::make_shared<CommandLineUI>(handler, &CommandLineUI::ParseAttack);
+	auto attackParser = Arcade::LambdaParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>::make_shared([&](std::string arg) -> std::shared_ptr<Arcade::ICommand<std::shared_ptr<Board>>>
+	{
+		return std::make_shared<JournaledCommand>(journal, handler.ParseAttack(arg));
+	});
 	handler.AddActionParser("a", attackParser);
 
-	auto runCommandsParser = Arcade::LambdaParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>::make_shared([=](std::string arg) -> std::shared_ptr<Arcade::ICommand<std::shared_ptr<Board>>>
+	auto undoParser = Arcade::LambdaParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>::make_shared([&](std::string arg) -> std::shared_ptr<Arcade::ICommand<std::shared_ptr<Board>>>
+	{
+		int count = ParseActionCount(arg);
+		int undone = 0;
+		while (undone < count && journal->Undo())
+			undone++;
+
+		if (count < 0)
+			std::cout << "'" << arg << "' is geen geldig aantal acties." << std::endl;
+		else if (undone == 0)
+			std::cout << "Er zijn geen acties om ongedaan te maken." << std::endl;
+		else
+			handler.Display();
+		return Arcade::EmptyCommand<std::shared_ptr<Board>>::GetInstance();
+	});
+	handler.AddActionParser("undo", undoParser);
+
+	auto redoParser = Arcade::LambdaParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>::make_shared([&](std::string arg) -> std::shared_ptr<Arcade::ICommand<std::shared_ptr<Board>>>
+	{
+		int count = ParseActionCount(arg);
+		int redone = 0;
+		while (redone < count && journal->Redo())
+			redone++;
+
+		if (count < 0)
+			std::cout << "'" << arg << "' is geen geldig aantal acties." << std::endl;
+		else if (redone == 0)
+			std::cout << "Er zijn geen acties om opnieuw uit te voeren." << std::endl;
+		else
+			handler.Display();
+		return Arcade::EmptyCommand<std::shared_ptr<Board>>::GetInstance();
+	});
+	handler.AddActionParser("redo", redoParser);
+
+	auto runCommandsParser = Arcade::LambdaParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>::make_shared([&](std::string arg) -> std::shared_ptr<Arcade::ICommand<std::shared_ptr<Board>>>
 	{
 		try
 		{
-			return std::make_shared<Arcade::CompositeCommand<std::shared_ptr<Board>>>(parseMoves(arg.c_str(), *b, std::cerr));
+			// Every action in the file can be undone on its own.
+			std::vector<std::shared_ptr<ICommand<std::shared_ptr<Board>>>> commands;
+			auto moves = parseMoves(arg.c_str(), *handler.GetScene(), std::cerr);
+			for (int i = 0; i < moves.GetLength(); i++)
+				commands.push_back(std::make_shared<JournaledCommand>(journal, moves[i]));
+			return std::make_shared<Arcade::CompositeCommand<std::shared_ptr<Board>>>(commands);
 		}
 		catch (const BadXMLException& /* e */)
 		{
@@ -142,12 +162,58 @@ int StartInteractive(int argc, const char* argv[])
 	});
 	handler.AddActionParser("run", runCommandsParser);
 
-	handler.AddActionParser("save", CreateSaveCommandParser(b, [] { return std::make_shared<XmlUIHandler>(&std::cout); }));
-	handler.AddActionParser("xml", CreateSaveCommandParser(b, [] { return std::make_shared<XmlUIHandler>(&std::cout); }));
-	handler.AddActionParser("html", CreateSaveCommandParser(b, [] { return std::make_shared<HtmlUIHandler>(&std::cout); }));
-	handler.AddActionParser("ascii", CreateSaveCommandParser(b, [] { return std::make_shared<ASCIIArtUIHandler>(&std::cout); }));
-	handler.AddActionParser("cg", CreateSaveCommandParser(b, [] { return std::make_shared<CGUIHandler>(&std::cout); }));
-	handler.AddActionParser("text", CreateSaveCommandParser(b, [] { return std::make_shared<TextUIHandler>(&std::cout, &std::cerr, false); }));
+	// "replay Acties.xml" loads a replay that starts at the current
+	// board, and "goto N" jumps to step N of that replay.
+	std::shared_ptr<CheckpointedReplay> replay;
+	auto replayParser = Arcade::LambdaParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>::make_shared([&](std::string arg) -> std::shared_ptr<Arcade::ICommand<std::shared_ptr<Board>>>
+	{
+		try
+		{
+			auto commands = parseCommandStream(arg.c_str(), *handler.GetScene(), std::cerr);
+			replay = std::make_shared<CheckpointedReplay>(handler.GetScene(), commands, CheckpointedReplay::DefaultInterval);
+			std::cout << "Replay met " << replay->GetLength() << " acties geladen. Gebruik 'goto N' om naar stap N te gaan." << std::endl;
+		}
+		catch (const BadXMLException& /* e */)
+		{
+			// Errors are displayed elsewhere
+		}
+		return Arcade::EmptyCommand<std::shared_ptr<Board>>::GetInstance();
+	});
+	handler.AddActionParser("replay", replayParser);
+
+	auto gotoParser = Arcade::LambdaParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>::make_shared([&](std::string arg) -> std::shared_ptr<Arcade::ICommand<std::shared_ptr<Board>>>
+	{
+		if (replay == nullptr)
+		{
+			std::cout << "Er is geen replay geladen. Gebruik 'replay Acties.xml' om er een te laden." << std::endl;
+			return Arcade::EmptyCommand<std::shared_ptr<Board>>::GetInstance();
+		}
+
+		char* end;
+		long step = std::strtol(arg.c_str(), &end, 10);
+		if (arg.empty() || *end != '\0' || step < 0 || step > replay->GetLength())
+		{
+			std::cout << "'" << arg << "' is geen geldige stap. De replay telt " << replay->GetLength() << " stappen." << std::endl;
+			return Arcade::EmptyCommand<std::shared_ptr<Board>>::GetInstance();
+		}
+
+		handler.GetHandler()->SetScene(replay->Seek((int)step));
+		// The journal's entries apply to the previous board.
+		journal = std::make_shared<BoardJournal>(handler.GetScene());
+		std::cout << "Stap " << step << " van " << replay->GetLength() << ":" << std::endl;
+		handler.Display();
+		return Arcade::EmptyCommand<std::shared_ptr<Board>>::GetInstance();
+	});
+	handler.AddActionParser("goto", gotoParser);
+
+	// Saves write the live board, which "goto" may have replaced.
+	auto scene = [&] { return handler.GetScene(); };
+	handler.AddActionParser("save", CreateSaveCommandParser(scene, [] { return std::make_shared<XmlUIHandler>(&std::cout); }));
+	handler.AddActionParser("xml", CreateSaveCommandParser(scene, [] { return std::make_shared<XmlUIHandler>(&std::cout); }));
+	handler.AddActionParser("html", CreateSaveCommandParser(scene, [] { return std::make_shared<HtmlUIHandler>(&std::cout); }));
+	handler.AddActionParser("ascii", CreateSaveCommandParser(scene, [] { return std::make_shared<ASCIIArtUIHandler>(&std::cout); }));
+	handler.AddActionParser("cg", CreateSaveCommandParser(scene, [] { return std::make_shared<CGUIHandler>(&std::cout); }));
+	handler.AddActionParser("text", CreateSaveCommandParser(scene, [] { return std::make_shared<TextUIHandler>(&std::cout, &std::cerr, false); }));
 
 	handler.Initialize(b); // Initialize the handler, display the board.
 
@@ -156,6 +222,112 @@ int StartInteractive(int argc, const char* argv[])
 	return 0;
 }
 
+int StartBatch(int argc, const char* argv[])
+{
+	std::ifstream manifest(argv[2]);
+	if (!manifest.is_open())
+	{
+		std::cerr << "Het bestand '" << argv[2] << "' kon niet geopend worden." << std::endl;
+		return 1;
+	}
+
+	std::vector<BatchJob> jobs;
+	bool wellFormed = ParseBatchManifest(manifest, jobs, std::cerr);
+
+	int threadCount = argc > 4 ? std::atoi(argv[4]) : 0;
+	WorkStealingPool pool(threadCount > 0 ? threadCount : WorkStealingPool::GetDefaultThreadCount());
+	auto results = RunBatch(jobs, pool);
+
+	auto outputPath = GetArgument<std::string>(3, "", argc, argv);
+	std::ofstream target;
+	if (!outputPath.empty())
+	{
+		target.open(outputPath);
+		if (!target.is_open())
+			std::cerr << "Het bestand '" << outputPath << "' kon niet geopend worden." << std::endl;
+	}
+	std::ostream& output = target.is_open() ? target : std::cout;
+	for (std::size_t i = 0; i < jobs.size(); i++)
+		WriteBatchResult(output, jobs[i], results[i]);
+	output.flush();
+
+	return wellFormed ? 0 : 1;
+}
+
+int StartSimulate(int argc, const char* argv[])
+{
+	auto format = GetArgument<std::string>(4, "json", argc, argv);
+	if (argc < 4 || (format != "json" && format != "csv"))
+	{
+		PrintUsage(argv[0]);
+		return 1;
+	}
+
+	BatchJob job;
+	job.BoardPath = argv[2];
+	job.ActionsPath = argv[3];
+	auto result = RunBatchJob(job);
+	if (format == "csv")
+		WriteSimulationCsv(std::cout, result);
+	else
+		WriteSimulationJson(std::cout, result);
+
+	return result.Status == BatchStatus::Error ? 1 : 0;
+}
+
+int StartSolve(int argc, const char* argv[])
+{
+	SolverOptions options;
+	auto algorithm = GetArgument<std::string>(4, "astar", argc, argv);
+	if (argc > 5)
+		options.MaxStates = std::atoi(argv[5]);
+	if ((algorithm != "astar" && algorithm != "bfs" && algorithm != "parallel") || options.MaxStates <= 0)
+	{
+		PrintUsage(argv[0]);
+		return 1;
+	}
+	options.Algorithm = algorithm == "bfs" ? SolverAlgorithm::BreadthFirst : SolverAlgorithm::AStar;
+
+	std::shared_ptr<Board> b;
+	try
+	{
+		b = std::make_shared<Board>(parseBoard(argv[2], std::cerr));
+	}
+	catch (const BadXMLException& /* e */)
+	{
+		return 1; // Errors are displayed elsewhere
+	}
+
+	// The parallel search is a breadth-first search, which spreads
+	// every layer across the pool's threads.
+	int threadCount = argc > 6 ? std::atoi(argv[6]) : 0;
+	WorkStealingPool pool(threadCount > 0 ? threadCount : WorkStealingPool::GetDefaultThreadCount());
+	auto start = std::chrono::steady_clock::now();
+	auto result = algorithm == "parallel" ? Solver(b).SolveParallel(options, pool) : Solver(b).Solve(options);
+	auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	std::cerr << GetSolverStatusName(result.Status) << ": " << result.Actions.GetLength() << " acties, "
+			  << result.VisitedStates << " toestanden bezocht, " << result.ExpandedStates << " uitgebreid in "
+			  << elapsed << " ms." << std::endl;
+	if (result.Status != SolverStatus::Solved)
+		return 1;
+
+	if (argc > 3)
+	{
+		std::ofstream output(argv[3]);
+		if (!output.is_open())
+		{
+			std::cerr << "Het bestand '" << argv[3] << "' kon niet geopend worden." << std::endl;
+			return 1;
+		}
+		WriteActionsXml(output, result.Actions);
+	}
+	else
+	{
+		WriteActionsXml(std::cout, result.Actions);
+	}
+	return 0;
+}
+
 int main(int argc, const char* argv[])
 {
 	if (argc < 3)
@@ -172,6 +344,18 @@ int main(int argc, const char* argv[])
 	{
 		return StartInteractive(argc, argv);
 	}
+	else if (mode == "batch")
+	{
+		return StartBatch(argc, argv);
+	}
+	else if (mode == "simulate")
+	{
+		return StartSimulate(argc, argv);
+	}
+	else if (mode == "solve")
+	{
+		return StartSolve(argc, argv);
+	}
 
 	bool simulate, slideshow;
 	std::shared_ptr<UIHandlerBase> handler;
@@ -245,7 +429,7 @@ int main(int argc, const char* argv[])
 	{
 		WriteToFile(*handler, outputCommandsPath, [&](UIHandlerBase& h)
 		{
-			for (auto item : moves)
+			for (auto& item : moves)
 			{
 				h.Apply(item);
 				h.Display();
@@ -272,7 +456,7 @@ int main(int argc, const char* argv[])
 			{
 				*h.GetOutputStream() << "Geen bewegingen.";
 			}
-			for (auto item : moves)
+			for (auto& item : moves)
 			{
 				h.Apply(item);
 			}
@@ -1,5 +1,6 @@
 #include "Monster.h"
 
+#include <memory>
 #include <string>
 #include "Actor.h"
 #include "Board.h"
@@ -22,20 +23,27 @@ Monster::Monster(Vector2<int> Position, std::string Name)
     ensure(this->CheckInvariants());
 }
 
+/// \brief Creates a copy of this piece that shares its
+/// identifier.
+std::shared_ptr<PieceBase> Monster::Clone() const
+{
+    return std::make_shared<Monster>(*this);
+}
+
 /// \brief Has a piece collide with this piece.
 /// A boolean is returned that indicates whether another piece
 /// is free to move onto this piece's (previous) position or
 /// not.
-/// \pre require(Event.GetStaticPiece().get() == this);
+/// \pre require(Event.GetStaticPiece() == this);
 /// \pre require(this->CheckInvariants());
 /// \post ensure(this->CheckInvariants());
 bool Monster::Collide(Collision Event)
 {
-    require(Event.GetStaticPiece().get() == this);
+    require(Event.GetStaticPiece() == this);
     require(this->CheckInvariants());
-    if (stdx::isinstance<Actor>(Event.GetMovingPiece()))
+    if (stdx::isinstance<Actor>(*Event.GetMovingPiece()))
     {
-        bool result = Event.GetScene()->RemovePiece(Event.GetMovingPiece());
+        bool result = Event.GetScene()->RemovePiece(Event.GetMovingHandle());
         ensure(this->CheckInvariants());
         return result;
     }
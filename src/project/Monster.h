@@ -1,4 +1,5 @@
 #pragma once
+#include <memory>
 #include <string>
 #include "Actor.h"
 #include "Collision.h"
@@ -14,11 +15,15 @@ namespace Arcade
         /// \post ensure(this->CheckInvariants());
         Monster(Vector2<int> Position, std::string Name);
 
+        /// \brief Creates a copy of this piece that shares its
+        /// identifier.
+        std::shared_ptr<PieceBase> Clone() const override;
+
         /// \brief Has a piece collide with this piece.
         /// A boolean is returned that indicates whether another piece
         /// is free to move onto this piece's (previous) position or
         /// not.
-        /// \pre require(Event.GetStaticPiece().get() == this);
+        /// \pre require(Event.GetStaticPiece() == this);
         /// \pre require(this->CheckInvariants());
         /// \post ensure(this->CheckInvariants());
         virtual bool Collide(Collision Event) override;
@@ -48,30 +48,40 @@ bool MoveCommand::CheckInvariants() const
 bool MoveCommand::Execute(std::shared_ptr<Board> TargetBoard)
 {
     require(this->CheckInvariants());
-    auto goalPos = this->GetTarget()->GetPosition() + this->GetOffset();
-    if (!TargetBoard->InRange(goalPos))
-    {
-        bool result = false;
-        ensure(this->CheckInvariants());
-        return result;
-    }
-    auto obstacle = TargetBoard->GetItem(goalPos);
-    if (obstacle != nullptr)
-    {
-        Collision collision(TargetBoard, this->GetTarget(), obstacle);
-        if (!obstacle->Collide(collision))
-        {
-            bool result = !TargetBoard->HasPiece(this->GetTarget());
-            ensure(this->CheckInvariants());
-            return result;
-        }
-    }
-    this->GetTarget()->Move(goalPos);
-    bool result = true;
+    // Look the target up by identifier, so that commands act on the
+    // target board's own copy of the actor, even if that board is a
+    // fork of the board the command was created for.
+    bool result = Apply(*TargetBoard, TargetBoard->GetHandle(*this->GetTarget()), this->GetOffset());
     ensure(this->CheckInvariants());
     return result;
 }
 
+/// \brief Moves the piece that the given handle refers to by the
+/// given offset on the given board, and returns a boolean that
+/// tells if the operation has completed successfully. This is
+/// what executing a move command amounts to.
+/// \pre require(Offset != Vector2<int>());
+bool MoveCommand::Apply(Board& Scene, PieceHandle Target, Vector2<int> Offset)
+{
+    require(Offset != Vector2<int>());
+    // The pieces are referred to by handle, so that the collision
+    // chain does not touch any reference counts.
+    if (!Scene.HasPiece(Target))
+        return false;
+
+    auto goalPos = Scene.GetPiece(Target)->GetPosition() + Offset;
+    if (!Scene.InRange(goalPos))
+        return false;
+
+    auto obstacle = Scene.GetItemHandle(goalPos);
+    if (obstacle.IsValid() && !Scene.GetPiece(obstacle)->Collide(Collision(&Scene, Target, obstacle)))
+        return !Scene.HasPiece(Target);
+
+    if (Scene.HasPiece(Target))
+        Scene.MovePiece(Target, goalPos);
+    return true;
+}
+
 /// \brief Gets the move command's move offset.
 /// \pre require(this->CheckInvariants());
 Vector2<int> MoveCommand::GetOffset() const
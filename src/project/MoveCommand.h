@@ -4,6 +4,7 @@
 #include "Board.h"
 #include "Contracts.h"
 #include "ICommand.h"
+#include "PieceHandle.h"
 #include "Vector2.h"
 
 namespace Arcade
@@ -36,6 +37,13 @@ namespace Arcade
         //     return true;
         // }
 
+        /// \brief Moves the piece that the given handle refers to by the
+        /// given offset on the given board, and returns a boolean that
+        /// tells if the operation has completed successfully. This is
+        /// what executing a move command amounts to.
+        /// \pre require(Offset != Vector2<int>());
+        static bool Apply(Board& Scene, PieceHandle Target, Vector2<int> Offset);
+
         /// \brief Executes the command and returns a boolean that tells if
         /// the operation has completed successfully.
         /// \pre require(this->CheckInvariants());
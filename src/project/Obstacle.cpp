@@ -1,7 +1,9 @@
 #include "Obstacle.h"
 
+#include <memory>
 #include <string>
 #include "PieceBase.h"
+#include "Symbol.h"
 #include "Vector2.h"
 
 using namespace Arcade;
@@ -12,13 +14,20 @@ Obstacle::Obstacle()
 
 /// \brief Creates a new obstacle object based on the given
 /// arguments.
-Obstacle::Obstacle(Vector2<int> Position, std::string ObstacleType, bool Movable)
+Obstacle::Obstacle(Vector2<int> Position, Symbol ObstacleType, bool Movable)
 {
     this->SetPosition(Position);
     this->SetObstacleType(ObstacleType);
     this->SetMovable(Movable);
 }
 
+/// \brief Creates a copy of this piece that shares its
+/// identifier.
+std::shared_ptr<PieceBase> Obstacle::Clone() const
+{
+    return std::make_shared<Obstacle>(*this);
+}
+
 /// \brief Gets a boolean value that indicates whether this piece is a
 /// terrain piece, i.e. it can share its position with another
 /// piece.
@@ -39,13 +48,13 @@ bool Obstacle::GetMovable() const
 }
 
 /// \brief Sets this obstacle's obstacle type.
-void Obstacle::SetObstacleType(std::string value)
+void Obstacle::SetObstacleType(Symbol value)
 {
     this->ObstacleType_value = value;
 }
 
 /// \brief Gets this obstacle's obstacle type.
-std::string Obstacle::GetObstacleType() const
+Symbol Obstacle::GetObstacleType() const
 {
     return this->ObstacleType_value;
 }
\ No newline at end of file
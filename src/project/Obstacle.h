@@ -1,6 +1,8 @@
 #pragma once
+#include <memory>
 #include <string>
 #include "PieceBase.h"
+#include "Symbol.h"
 #include "Vector2.h"
 
 namespace Arcade
@@ -11,13 +13,17 @@ namespace Arcade
     public:
         /// \brief Creates a new obstacle object based on the given
         /// arguments.
-        Obstacle(Vector2<int> Position, std::string ObstacleType, bool Movable);
+        Obstacle(Vector2<int> Position, Symbol ObstacleType, bool Movable);
+
+        /// \brief Creates a copy of this piece that shares its
+        /// identifier.
+        std::shared_ptr<PieceBase> Clone() const override;
 
         /// \brief Finds out if the given piece can be moved or not.
         bool GetMovable() const override;
 
         /// \brief Gets this obstacle's obstacle type.
-        std::string GetObstacleType() const;
+        Symbol GetObstacleType() const;
 
         /// \brief Gets a boolean value that indicates whether this piece is a
         /// terrain piece, i.e. it can share its position with another
@@ -30,9 +36,9 @@ namespace Arcade
         void SetMovable(bool value);
 
         /// \brief Sets this obstacle's obstacle type.
-        void SetObstacleType(std::string value);
+        void SetObstacleType(Symbol value);
     private:
         bool Movable_value = false;
-        std::string ObstacleType_value;
+        Symbol ObstacleType_value;
     };
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "Player.h"
 #include "Obstacle.h"
 #include "Contracts.h"
+#include "CommandStream.h"
 #include "MoveCommand.h"
 #include "TextUIHandler.h"
 #include "Water.h"
@@ -260,7 +261,7 @@ namespace Arcade
 				{
 					auto pos = readBoardPosition(e, board, "knop", true);
 					auto id = trimString(attribute(e, PIECE_ID_ATTR));
-					auto pc = std::make_shared<Button>(pos);
+					auto pc = board.GetArena()->Create<Button>(pos);
 					results[id].push_back(pc);
 					board.AddPiece(pc);
 				}, error_stream);
@@ -276,43 +277,43 @@ namespace Arcade
 		if (value == BOARD_PLAYER_TAG) {
 			std::string name(readStringContents(child(e, PLAYER_NAME_TAG)));
 			Vector2<int> pos = readBoardPosition(e, board, "speler " + name, false);
-			return std::make_shared<Player>(pos, name);
+			return board.GetArena()->Create<Player>(pos, name);
 		}
 		else if (value == BOARD_WALL_TAG || value == BOARD_BARREL_TAG) {
 			std::string type = (value == BOARD_WALL_TAG) ? "muur" : "ton";
 			Vector2<int> pos = readBoardPosition(e, board, type, false);
 			bool canMove = readBool(attribute(e, PIECE_MOVABLE_ATTR));
-			return std::make_shared<Obstacle>(pos, type, canMove);
+			return board.GetArena()->Create<Obstacle>(pos, type, canMove);
 		}
 		else if (value == BOARD_OBSTACLE_TAG) // For legacy purposes
 		{
 			bool canMove = readBool(attribute(e, PIECE_MOVABLE_ATTR));
 			std::string type = canMove ? "ton" : "muur";
 			Vector2<int> pos = readBoardPosition(e, board, type, false);
-			return std::make_shared<Obstacle>(pos, type, canMove);
+			return board.GetArena()->Create<Obstacle>(pos, type, canMove);
 		}
 		else if (value == BOARD_WATER_TAG) {
 			Vector2<int> pos = readBoardPosition(e, board, "water", false);
 			bool canMove = readBool(attribute(e, PIECE_MOVABLE_ATTR));
-			return std::make_shared<Water>(pos, canMove);
+			return board.GetArena()->Create<Water>(pos, canMove);
 		}
 		else if (value == BOARD_GOAL_TAG) {
 			Vector2<int> pos = readBoardPosition(e, board, "doel", true);
-			return std::make_shared<Goal>(pos);
+			return board.GetArena()->Create<Goal>(pos);
 		}
 		else if (value == BOARD_GATE_TAG) {
 			auto pos = readBoardPosition(e, board, "poort", false);
 			auto name = readStringContents(child(e, BOARD_ID_TAG));
-			return std::make_shared<Gate>(pos, name, Buttons[name]);
+			return board.GetArena()->Create<Gate>(pos, name, Buttons[name]);
 		}
 		else if (value == BOARD_MONSTER_TAG) {
 			Vector2<int> pos = readBoardPosition(e, board, "monster", false);
 			std::string name(readStringContents(child(e, BOARD_ID_TAG)));
-			return std::make_shared<Monster>(pos, name);
+			return board.GetArena()->Create<Monster>(pos, name);
 		}
 		else if (value == BOARD_TRAP_TAG) {
 			Vector2<int> pos = readBoardPosition(e, board, "valstrik", false);
-			return std::make_shared<Trap>(pos);
+			return board.GetArena()->Create<Trap>(pos);
 		}
 		// TODO: other pieces
 		else if (value != BOARD_NAME_TAG && value != BOARD_LENGTH_TAG
@@ -393,7 +394,7 @@ namespace Arcade
 	}
 
 	/// \brief Parses a move command document.
-	CommandArray parseMoves(const char *filename, const Board &board, std::ostream &error_stream) {
+	CommandStream parseCommandStream(const char *filename, const Board &board, std::ostream &error_stream) {
 		XMLDocument doc;
 		doc.LoadFile(filename);
 
@@ -406,7 +407,7 @@ namespace Arcade
 			}, error_stream);
 		}
 
-		std::vector<std::shared_ptr<ICommand<std::shared_ptr<Board>>>> moveList;
+		CommandStream moveList;
 
 		// Parse Board data.
 		const XMLElement *moves = anyChild(&doc, { ACTIONS_TAG, MOVES_TAG });
@@ -434,15 +435,19 @@ namespace Arcade
 
 				if (value == MOVES_MOVE_TAG)
 				{
-					moveList.push_back(std::make_shared<MoveCommand>(player, direction));
+					moveList.Append(ActionKind::Move, player, direction);
 				}
 				else
 				{
-					moveList.push_back(std::make_shared<AttackCommand>(player, direction));
+					moveList.Append(ActionKind::Attack, player, direction);
 				}
 			}, error_stream);
 		}
 
 		return moveList;
 	}
+
+	CommandArray parseMoves(const char *filename, const Board &board, std::ostream &error_stream) {
+		return parseCommandStream(filename, board, error_stream).ToCommands();
+	}
 }
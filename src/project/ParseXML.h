@@ -4,6 +4,7 @@
 #include "Player.h"
 #include "Obstacle.h"
 #include "Contracts.h"
+#include "CommandStream.h"
 #include "MoveCommand.h"
 #include "TextUIHandler.h"
 
@@ -44,6 +45,11 @@ namespace Arcade
 
 	Board parseBoard(const char *filename, std::ostream &error_stream);
 
+	/// \brief Parses the actions in the given file into a packed
+	/// command stream.
+	CommandStream parseCommandStream(const char *filename, const Board &board, std::ostream &error_stream);
+
+	/// \brief Parses the actions in the given file into command objects.
 	CommandArray parseMoves(const char *filename, const Board &board, std::ostream &error_stream);
 
 	/// \brief "Trims" a word in a string, removing all whitespace around it.
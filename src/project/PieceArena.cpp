@@ -0,0 +1,45 @@
+#include "PieceArena.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace Arcade;
+
+/// \brief Creates a new arena that allocates blocks of the given
+/// size. No memory is allocated until the first object is
+/// created.
+PieceArena::PieceArena(std::size_t BlockSize)
+    : blockSize(BlockSize), capacity(0), current(nullptr), remaining(0)
+{ }
+
+/// \brief Allocates a chunk of memory of the given size and
+/// alignment from this arena.
+void* PieceArena::Allocate(std::size_t Size, std::size_t Alignment)
+{
+    std::size_t padding = (Alignment - (std::uintptr_t)this->current % Alignment) % Alignment;
+    if (this->current == nullptr || padding + Size > this->remaining)
+    {
+        // Start a new block. Oversized requests get a block of
+        // their own.
+        std::size_t size = Size + Alignment > this->blockSize ? Size + Alignment : this->blockSize;
+        this->blocks.push_back(std::unique_ptr<char[]>(new char[size]));
+        this->capacity += size;
+        this->current = this->blocks.back().get();
+        this->remaining = size;
+        padding = (Alignment - (std::uintptr_t)this->current % Alignment) % Alignment;
+    }
+
+    void* result = this->current + padding;
+    this->current += padding + Size;
+    this->remaining -= padding + Size;
+    return result;
+}
+
+/// \brief Gets the total size of the blocks that this arena has
+/// allocated.
+std::size_t PieceArena::GetCapacity() const
+{
+    return this->capacity;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Arcade
+{
+    /// \brief Describes an arena that hands out memory for pieces from a
+    /// small number of large blocks, so that the pieces of a board end
+    /// up next to each other in memory. Memory is never returned to an
+    /// arena piecemeal: all of its blocks are freed together, when the
+    /// arena and every object created in it have been destroyed.
+    /// \remark Arenas are not thread-safe.
+    class PieceArena : public std::enable_shared_from_this<PieceArena>
+    {
+    public:
+        /// \brief Creates a new arena that allocates blocks of the given
+        /// size. No memory is allocated until the first object is
+        /// created.
+        PieceArena(std::size_t BlockSize = 64 * 1024);
+
+        /// \brief Allocates a chunk of memory of the given size and
+        /// alignment from this arena.
+        void* Allocate(std::size_t Size, std::size_t Alignment);
+
+        /// \brief Creates an object of the given type in this arena, and
+        /// returns a shared pointer to it. The shared pointer's control
+        /// block is allocated in the arena as well, and keeps the arena
+        /// alive.
+        template<typename T, typename... TArgs>
+        std::shared_ptr<T> Create(TArgs&&... Args);
+
+        /// \brief Gets the total size of the blocks that this arena has
+        /// allocated.
+        std::size_t GetCapacity() const;
+
+    private:
+        std::size_t blockSize;
+        std::vector<std::unique_ptr<char[]>> blocks;
+        std::size_t capacity;
+        char* current;
+        std::size_t remaining;
+    };
+
+    /// \brief An allocator that allocates memory from a piece arena.
+    /// Deallocation is a no-op: the memory is reclaimed when the arena
+    /// is destroyed.
+    template<typename T>
+    class ArenaAllocator
+    {
+    public:
+        typedef T value_type;
+
+        /// \brief Creates an allocator for the given arena.
+        ArenaAllocator(std::shared_ptr<PieceArena> Arena)
+            : arena(std::move(Arena)) { }
+
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U>& Other)
+            : arena(Other.GetArena()) { }
+
+        T* allocate(std::size_t Count)
+        {
+            return static_cast<T*>(this->arena->Allocate(Count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* /*Pointer*/, std::size_t /*Count*/) { }
+
+        /// \brief Gets the arena this allocator allocates from.
+        const std::shared_ptr<PieceArena>& GetArena() const { return this->arena; }
+
+        template<typename U>
+        bool operator==(const ArenaAllocator<U>& Other) const { return this->arena == Other.GetArena(); }
+        template<typename U>
+        bool operator!=(const ArenaAllocator<U>& Other) const { return this->arena != Other.GetArena(); }
+
+    private:
+        std::shared_ptr<PieceArena> arena;
+    };
+
+    template<typename T, typename... TArgs>
+    std::shared_ptr<T> PieceArena::Create(TArgs&&... Args)
+    {
+        return std::allocate_shared<T>(ArenaAllocator<T>(this->shared_from_this()), std::forward<TArgs>(Args)...);
+    }
+}
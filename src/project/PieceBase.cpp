@@ -1,5 +1,6 @@
 #include "PieceBase.h"
 
+#include <atomic>
 #include <memory>
 #include "Actor.h"
 #include "Board.h"
@@ -10,24 +11,38 @@
 
 using namespace Arcade;
 
+/// \brief The identifier that will be given to the next piece.
+static std::atomic<int> nextPieceId(0);
+
 /// \brief Creates a new piece at the origin.
 PieceBase::PieceBase()
 {
     this->SetPosition(Vector2<int>(0, 0));
+    this->Id_value = nextPieceId++;
 }
 
 /// \brief Creates a new piece at the given position.
 PieceBase::PieceBase(Vector2<int> Position)
 {
     this->SetPosition(Position);
+    this->Id_value = nextPieceId++;
+}
+
+/// \brief Gets the piece's identifier. Every piece gets a unique
+/// identifier when it is created, which its clones inherit.
+/// The identifier can therefore be used to find a piece's
+/// counterpart on a forked board.
+int PieceBase::GetId() const
+{
+    return this->Id_value;
 }
 
 /// \brief Attacks this piece. A boolean is returned which indicates
 /// whether it has been destroyed or not.
-/// \pre require(Event.GetStaticPiece().get() == this);
+/// \pre require(Event.GetStaticPiece() == this);
 bool PieceBase::Attack(Collision Event)
 {
-    require(Event.GetStaticPiece().get() == this);
+    require(Event.GetStaticPiece() == this);
     return false;
 }
 
@@ -35,30 +50,35 @@ bool PieceBase::Attack(Collision Event)
 /// A boolean is returned that indicates whether another piece
 /// is free to move onto this piece's (previous) position or
 /// not.
-/// \pre require(Event.GetStaticPiece().get() == this);
+/// \pre require(Event.GetStaticPiece() == this);
 bool PieceBase::Collide(Collision Event)
 {
-    require(Event.GetStaticPiece().get() == this);
+    require(Event.GetStaticPiece() == this);
     return this->CollideAndMove(Event);
 }
 
 /// \brief The default collide-and-move behavior for pieces.
-/// \pre require(Event.GetStaticPiece().get() == this);
+/// \pre require(Event.GetStaticPiece() == this);
 bool PieceBase::CollideAndMove(Collision Event)
 {
-    require(Event.GetStaticPiece().get() == this);
+    require(Event.GetStaticPiece() == this);
     if (!this->GetMovable())
         return false;
 
+    auto scene = Event.GetScene();
     auto goalPos = this->GetPosition() + Event.GetOffset();
-    if (!Event.GetScene()->InRange(goalPos))
+    if (!scene->InRange(goalPos))
         return false;
 
-    auto other = Event.GetScene()->GetItem(goalPos);
-    if (other != nullptr && !other->Collide(Collision(Event.GetScene(), Event.GetStaticPiece(), other)))
+    // The collisions below may remove this piece from the board, so
+    // it is only referred to by handle from here on.
+    auto self = Event.GetStaticHandle();
+    auto other = scene->GetItemHandle(goalPos);
+    if (other.IsValid() && !scene->GetPiece(other)->Collide(Collision(scene, self, other)))
         return false;
 
-    this->Move(this->GetPosition() + Event.GetOffset());
+    if (scene->HasPiece(self))
+        scene->MovePiece(self, goalPos);
     return true;
 }
 
@@ -1,4 +1,5 @@
 #pragma once
+#include <memory>
 #include "Vector2.h"
 
 namespace Arcade
@@ -19,16 +20,27 @@ namespace Arcade
 
         /// \brief Attacks this piece. A boolean is returned which indicates
         /// whether it has been destroyed or not.
-        /// \pre require(Event.GetStaticPiece().get() == this);
+        /// \pre require(Event.GetStaticPiece() == this);
         virtual bool Attack(Collision Event);
 
         /// \brief Has a piece collide with this piece.
         /// A boolean is returned that indicates whether another piece
         /// is free to move onto this piece's (previous) position or
         /// not.
-        /// \pre require(Event.GetStaticPiece().get() == this);
+        /// \pre require(Event.GetStaticPiece() == this);
         virtual bool Collide(Collision Event);
 
+        /// \brief Creates a copy of this piece that shares its
+        /// identifier. Boards use this to give a fork its own copy of
+        /// a piece before the piece is mutated.
+        virtual std::shared_ptr<PieceBase> Clone() const = 0;
+
+        /// \brief Gets the piece's identifier. Every piece gets a unique
+        /// identifier when it is created, which its clones inherit.
+        /// The identifier can therefore be used to find a piece's
+        /// counterpart on a forked board.
+        int GetId() const;
+
         /// \brief Gets the piece's position.
         Vector2<int> GetPosition() const;
 
@@ -52,12 +64,23 @@ namespace Arcade
         int GetY() const;
     protected:
         /// \brief The default collide-and-move behavior for pieces.
-        /// \pre require(Event.GetStaticPiece().get() == this);
+        /// \pre require(Event.GetStaticPiece() == this);
         bool CollideAndMove(Collision Event);
 
         /// \brief Sets the piece's position.
         void SetPosition(Vector2<int> value);
     private:
+        friend class Board;
+
         Vector2<int> Position_value;
+        int Id_value;
+        /// \brief The index of the slot that this piece occupies on its
+        /// board and on that board's forks, or -1 if the piece has
+        /// never been added to a board.
+        int boardSlot = -1;
+        /// \brief The family of the board that this piece was added to,
+        /// i.e. the board and its forks, or zero if the piece has never
+        /// been added to a board.
+        unsigned boardFamily = 0;
     };
 }
\ No newline at end of file
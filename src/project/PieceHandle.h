@@ -0,0 +1,39 @@
+#pragma once
+
+namespace Arcade
+{
+    /// \brief A compact, non-owning reference to a piece on a board.
+    /// A handle consists of the piece's slot on the board and its
+    /// generation, which is the piece's identifier. Board slots are
+    /// never reused, and the generation tells a piece apart from
+    /// unrelated pieces in the same slot of another board, so a
+    /// handle to a removed piece never resolves to some other piece.
+    /// Forks of a board share its slots, so a handle can be resolved
+    /// on any fork of the board it was obtained from.
+    struct PieceHandle
+    {
+        /// \brief Creates a handle that does not refer to any piece.
+        PieceHandle()
+            : Index(-1), Generation(-1) { }
+
+        /// \brief Creates a handle from the given slot and generation.
+        PieceHandle(int Index, int Generation)
+            : Index(Index), Generation(Generation) { }
+
+        /// \brief Tells if this handle refers to a piece at all. A valid
+        /// handle may still refer to a piece that has since been
+        /// removed from the board.
+        bool IsValid() const { return this->Index >= 0; }
+
+        /// \brief Checks if this handle equals the given handle.
+        bool operator==(PieceHandle Other) const { return this->Index == Other.Index && this->Generation == Other.Generation; }
+
+        /// \brief Checks if this handle is not equal to the given handle.
+        bool operator!=(PieceHandle Other) const { return !(*this == Other); }
+
+        /// \brief The piece's slot on the board.
+        int Index;
+        /// \brief The piece's identifier.
+        int Generation;
+    };
+}
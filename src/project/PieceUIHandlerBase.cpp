@@ -2,10 +2,14 @@
 
 #include <memory>
 #include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
 #include "Actor.h"
 #include "Board.h"
 #include "Button.h"
 #include "Contracts.h"
+#include "DirtyCellTracker.h"
 #include "Gate.h"
 #include "Goal.h"
 #include "IsInstance.h"
@@ -13,6 +17,7 @@
 #include "Obstacle.h"
 #include "PieceBase.h"
 #include "Player.h"
+#include "Symbol.h"
 #include "Trap.h"
 #include "UIHandlerBase.h"
 #include "Vector2.h"
@@ -21,41 +26,117 @@
 using namespace Arcade;
 
 /// \brief Creates a new UI handler from the given output stream.
-/// \pre require(outputStream != nullptr);
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(outputStream != nullptr);
+/// \post ensure_cheap(this->CheckInvariants());
 PieceUIHandlerBase::PieceUIHandlerBase(std::ostream* outputStream)
     : UIHandlerBase(outputStream)
 {
-    require(outputStream != nullptr);
-    ensure(this->CheckInvariants());
+    require_cheap(outputStream != nullptr);
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the board.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::Display()
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     this->DisplayHeader();
-    for (int y = this->board->GetHeight() - 1; y >= 0; --y)
+    if (this->GetUsesFrameBuffer())
     {
-        for (int x = 0; x < this->board->GetWidth(); ++x)
-            this->DisplayPiece(this->board->GetItem(x, y), 
-                               Vector2<int>(x, y));
-        this->DisplayRow();
+        this->UpdateFrameBuffer();
+        for (int y = this->board->GetHeight() - 1; y >= 0; --y)
+            *this->outputStream << this->rows[y];
+    }
+    else
+    {
+        for (int y = this->board->GetHeight() - 1; y >= 0; --y)
+            this->DisplayRowCells(y);
     }
     this->DisplayFooter();
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Gets a boolean value that tells if this UI handler keeps
+/// a frame buffer of rendered rows. If so, then displaying the
+/// board only re-renders the rows that contain cells that have
+/// changed since the board was last displayed.
+/// \pre require_cheap(this->CheckInvariants());
+bool PieceUIHandlerBase::GetUsesFrameBuffer() const
+{
+    require_cheap(this->CheckInvariants());
+    return this->UsesFrameBuffer_value;
+}
+
+/// \brief Sets a boolean value that tells if this UI handler keeps
+/// a frame buffer of rendered rows. A frame buffer may only be
+/// used if the output for every cell depends on nothing but
+/// the contents of that cell.
+/// \pre require_cheap(!this->GetIsInitialized());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
+void PieceUIHandlerBase::SetUsesFrameBuffer(bool value)
+{
+    require_cheap(!this->GetIsInitialized());
+    require_cheap(this->CheckInvariants());
+    this->UsesFrameBuffer_value = value;
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Displays every cell in the given row, followed by the
+/// end of the row.
+void PieceUIHandlerBase::DisplayRowCells(int Y)
+{
+    for (int x = 0; x < this->board->GetWidth(); ++x)
+        this->DisplayPiece(this->board->GetItem(x, Y), 
+                           Vector2<int>(x, Y));
+    this->DisplayRow();
+}
+
+/// \brief Renders the given row into the frame buffer.
+void PieceUIHandlerBase::RenderRow(int Y)
+{
+    std::ostringstream row;
+    auto output = this->outputStream;
+    this->outputStream = &row;
+    this->DisplayRowCells(Y);
+    this->outputStream = output;
+    this->rows[Y] = row.str();
+}
+
+/// \brief Brings the frame buffer up to date with the board.
+void PieceUIHandlerBase::UpdateFrameBuffer()
+{
+    int height = this->board->GetHeight();
+    if (this->tracker == nullptr || this->tracker->GetScene() != this->board)
+    {
+        this->tracker = std::make_shared<DirtyCellTracker>(this->board);
+        this->rows.assign(height, std::string());
+        this->dirtyRows.assign(height, false);
+        for (int y = 0; y < height; ++y)
+            this->RenderRow(y);
+        return;
+    }
+
+    for (auto& item : this->tracker->GetDirtyCells())
+        this->dirtyRows[item.Y] = true;
+    for (auto& item : this->tracker->GetDirtyCells())
+        if (this->dirtyRows[item.Y])
+        {
+            this->RenderRow(item.Y);
+            this->dirtyRows[item.Y] = false;
+        }
+    this->tracker->Clear();
 }
 
 /// \brief Displays an actor piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayActor(std::shared_ptr<Actor> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     if (stdx::isinstance<Player>(Piece))
         this->DisplayPlayer(std::dynamic_pointer_cast<Player>(Piece));
     else if (stdx::isinstance<Monster>(Piece))
@@ -63,119 +144,121 @@ void PieceUIHandlerBase::DisplayActor(std::shared_ptr<Actor> Piece)
     else
         this->DisplayDefault(Piece);
 
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given barrel piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayBarrel(std::shared_ptr<Obstacle> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplayDefault(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a button piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayButton(std::shared_ptr<Button> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplayDefault(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays an empty cell.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayEmpty(Vector2<int> Position)
 {
-    require(this->CheckInvariants());
-    ensure(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a footer.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayFooter()
 {
-    require(this->CheckInvariants());
-    ensure(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a goal piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayGate(std::shared_ptr<Gate> Piece, bool IsOpened)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplayDefault(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a goal piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayGoal(std::shared_ptr<Goal> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplayDefault(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a header.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayHeader()
 {
-    require(this->CheckInvariants());
-    ensure(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given monster piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayMonster(std::shared_ptr<Monster> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplayDefault(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given obstacle piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayObstacle(std::shared_ptr<Obstacle> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
-    if (Piece->GetObstacleType() == "ton")
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
+    static const Symbol barrel("ton");
+    static const Symbol wall("muur");
+    if (Piece->GetObstacleType() == barrel)
         this->DisplayBarrel(Piece);
-    else if (Piece->GetObstacleType() == "muur")
+    else if (Piece->GetObstacleType() == wall)
         this->DisplayWall(Piece);
     else
         this->DisplayDefault(Piece);
 
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayPiece(std::shared_ptr<PieceBase> Piece, Vector2<int> Position)
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     if (Piece == nullptr)
         this->DisplayEmpty(Position);
     else if (stdx::isinstance<Actor>(Piece))
@@ -198,62 +281,62 @@ void PieceUIHandlerBase::DisplayPiece(std::shared_ptr<PieceBase> Piece, Vector2<
     else
         this->DisplayDefault(Piece);
 
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given player piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayPlayer(std::shared_ptr<Player> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplayDefault(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the end of a row.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayRow()
 {
-    require(this->CheckInvariants());
-    ensure(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a trap piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayTrap(std::shared_ptr<Trap> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplayDefault(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given wall piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayWall(std::shared_ptr<Obstacle> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplayDefault(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a water piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void PieceUIHandlerBase::DisplayWater(std::shared_ptr<Water> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplayDefault(Piece);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
\ No newline at end of file
@@ -1,8 +1,11 @@
 #pragma once
 #include <memory>
 #include <ostream>
+#include <string>
+#include <vector>
 #include "Actor.h"
 #include "Button.h"
+#include "DirtyCellTracker.h"
 #include "Gate.h"
 #include "Goal.h"
 #include "Monster.h"
@@ -22,108 +25,143 @@ namespace Arcade
     {
     public:
         /// \brief Creates a new UI handler from the given output stream.
-        /// \pre require(outputStream != nullptr);
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(outputStream != nullptr);
+        /// \post ensure_cheap(this->CheckInvariants());
         PieceUIHandlerBase(std::ostream* outputStream);
 
         /// \brief Displays the board.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void Display() override;
+
+        /// \brief Gets a boolean value that tells if this UI handler keeps
+        /// a frame buffer of rendered rows. If so, then displaying the
+        /// board only re-renders the rows that contain cells that have
+        /// changed since the board was last displayed.
+        /// \pre require_cheap(this->CheckInvariants());
+        bool GetUsesFrameBuffer() const;
     protected:
+        /// \brief Sets a boolean value that tells if this UI handler keeps
+        /// a frame buffer of rendered rows. A frame buffer may only be
+        /// used if the output for every cell depends on nothing but
+        /// the contents of that cell.
+        /// \pre require_cheap(!this->GetIsInitialized());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
+        void SetUsesFrameBuffer(bool value);
+
         /// \brief Displays an actor piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayActor(std::shared_ptr<Actor> Piece);
 
         /// \brief Displays the given barrel piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayBarrel(std::shared_ptr<Obstacle> Piece);
 
         /// \brief Displays a button piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayButton(std::shared_ptr<Button> Piece);
 
         /// \brief Applies the default display action to the given piece.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayDefault(std::shared_ptr<PieceBase> Piece) = 0;
 
         /// \brief Displays an empty cell.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayEmpty(Vector2<int> Position);
 
         /// \brief Displays a footer.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayFooter();
 
         /// \brief Displays a goal piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayGate(std::shared_ptr<Gate> Piece, bool IsOpened);
 
         /// \brief Displays a goal piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayGoal(std::shared_ptr<Goal> Piece);
 
         /// \brief Displays a header.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayHeader();
 
         /// \brief Displays the given monster piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayMonster(std::shared_ptr<Monster> Piece);
 
         /// \brief Displays the given obstacle piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayObstacle(std::shared_ptr<Obstacle> Piece);
 
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayPiece(std::shared_ptr<PieceBase> Piece, Vector2<int> Position);
 
         /// \brief Displays the given player piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayPlayer(std::shared_ptr<Player> Piece);
 
         /// \brief Displays the end of a row.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayRow();
 
         /// \brief Displays a trap piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayTrap(std::shared_ptr<Trap> Piece);
 
         /// \brief Displays the given wall piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayWall(std::shared_ptr<Obstacle> Piece);
 
         /// \brief Displays a water piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void DisplayWater(std::shared_ptr<Water> Piece);
+    private:
+        /// \brief Displays every cell in the given row, followed by the
+        /// end of the row.
+        void DisplayRowCells(int Y);
+
+        /// \brief Renders the given row into the frame buffer.
+        void RenderRow(int Y);
+
+        /// \brief Brings the frame buffer up to date with the board.
+        void UpdateFrameBuffer();
+
+        bool UsesFrameBuffer_value = false;
+        /// \brief Tracks the cells that have changed since the frame
+        /// buffer was last updated.
+        std::shared_ptr<DirtyCellTracker> tracker;
+        /// \brief The rendered rows, from bottom to top.
+        std::vector<std::string> rows;
+        /// \brief Tells if each row must be rendered again.
+        std::vector<bool> dirtyRows;
     };
 }
\ No newline at end of file
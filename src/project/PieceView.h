@@ -0,0 +1,90 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+#include "CowVector.h"
+
+namespace Arcade
+{
+    /// \brief A non-owning, read-only view of one of a board's piece
+    /// lists. Pieces that have been removed from the list are skipped.
+    /// A view is only valid for as long as the board it belongs to is
+    /// neither modified nor destroyed.
+    template<typename T>
+    class PieceView
+    {
+    public:
+        typedef int size_type;
+        typedef typename stdx::CowVector<std::shared_ptr<T>>::const_iterator base_iterator;
+
+        class const_iterator
+        {
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef std::shared_ptr<T> value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const std::shared_ptr<T>* pointer;
+            typedef const std::shared_ptr<T>& reference;
+
+            const_iterator() { }
+            const_iterator(base_iterator Position, base_iterator End)
+                : position(Position), end(End)
+            {
+                this->SkipRemoved();
+            }
+
+            const std::shared_ptr<T>& operator*() const { return *this->position; }
+            const std::shared_ptr<T>* operator->() const { return &*this->position; }
+            const_iterator& operator++() { ++this->position; this->SkipRemoved(); return *this; }
+            const_iterator operator++(int) { auto result = *this; ++*this; return result; }
+            bool operator==(const const_iterator& Other) const { return this->position == Other.position; }
+            bool operator!=(const const_iterator& Other) const { return this->position != Other.position; }
+
+        private:
+            void SkipRemoved()
+            {
+                while (this->position != this->end && *this->position == nullptr)
+                    ++this->position;
+            }
+
+            base_iterator position;
+            base_iterator end;
+        };
+
+        typedef const_iterator iterator;
+
+        /// \brief Creates a view of the given list, which contains the
+        /// given number of pieces that have not been removed.
+        PieceView(const stdx::CowVector<std::shared_ptr<T>>& Items, size_type Count)
+            : items(&Items), count(Count) { }
+
+        /// \brief Copies the viewed pieces into a new vector.
+        operator std::vector<std::shared_ptr<T>>() const
+        {
+            return std::vector<std::shared_ptr<T>>(this->begin(), this->end());
+        }
+
+        /// \brief Gets the first piece in this view.
+        const std::shared_ptr<T>& front() const
+        {
+            assert(!this->empty());
+            return *this->begin();
+        }
+
+        /// \brief Gets the number of pieces in this view.
+        size_type size() const { return this->count; }
+        /// \brief Tells if this view is empty.
+        bool empty() const { return this->count == 0; }
+
+        const_iterator begin() const { return const_iterator(this->items->begin(), this->items->end()); }
+        const_iterator end() const { return const_iterator(this->items->end(), this->items->end()); }
+        const_iterator cbegin() const { return this->begin(); }
+        const_iterator cend() const { return this->end(); }
+
+    private:
+        const stdx::CowVector<std::shared_ptr<T>>* items;
+        size_type count;
+    };
+}
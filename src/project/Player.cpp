@@ -1,5 +1,6 @@
 #include "Player.h"
 
+#include <memory>
 #include <string>
 #include "Actor.h"
 #include "Board.h"
@@ -23,22 +24,29 @@ Player::Player(Vector2<int> Position, std::string Name)
     ensure(this->CheckInvariants());
 }
 
+/// \brief Creates a copy of this piece that shares its
+/// identifier.
+std::shared_ptr<PieceBase> Player::Clone() const
+{
+    return std::make_shared<Player>(*this);
+}
+
 /// \brief Has a piece collide with this piece.
 /// A boolean is returned that indicates whether another piece
 /// is free to move onto this piece's (previous) position or
 /// not.
-/// \pre require(Event.GetStaticPiece().get() == this);
+/// \pre require(Event.GetStaticPiece() == this);
 /// \pre require(this->CheckInvariants());
 /// \post ensure(this->CheckInvariants());
 bool Player::Collide(Collision Event)
 {
-    require(Event.GetStaticPiece().get() == this);
+    require(Event.GetStaticPiece() == this);
     require(this->CheckInvariants());
-    if (stdx::isinstance<Monster>(Event.GetMovingPiece()))
+    if (stdx::isinstance<Monster>(*Event.GetMovingPiece()))
     {
-        bool result = Event.GetScene()->RemovePiece(Event.GetStaticPiece());
-        ensure(this->CheckInvariants());
-        return result;
+        // The player is destroyed if the board held the last
+        // reference to it, so it must not be touched afterwards.
+        return Event.GetScene()->RemovePiece(Event.GetStaticHandle());
     }
     else
     {
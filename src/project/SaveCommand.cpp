@@ -0,0 +1,82 @@
+#include "SaveCommand.h"
+
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include "Board.h"
+#include "EmptyCommand.h"
+#include "ICommand.h"
+#include "IParser.h"
+#include "IsInstance.h"
+#include "LambdaParser.h"
+#include "TextUIHandler.h"
+#include "UIHandlerBase.h"
+
+using namespace Arcade;
+
+/// \brief Points the given UI handler at the file with the given path,
+/// or at standard output if the path is empty, and runs the given
+/// function on the handler. If the file cannot be opened, an error
+/// is printed and the output goes to standard output instead.
+void Arcade::WriteToFile(UIHandlerBase& Handler, std::string FilePath, std::function<void(UIHandlerBase&)> Function)
+{
+    std::string path(FilePath);
+
+    if (path.size() == 0) // Use console as output
+    {
+        Handler.SetOutputStream(&std::cout);
+        Function(Handler);
+        std::cout << std::endl << std::endl;
+    }
+    else
+    {
+        std::ofstream target;
+        target.open(FilePath);
+        if (target.is_open())
+        {
+            if (stdx::isinstance<TextUIHandler>(Handler))
+            {
+                target << "Bestand: " << FilePath << std::endl << std::endl;
+            }
+            Handler.SetOutputStream(&target);
+        }
+        else
+        {
+            std::cout << "Het bestand '" << FilePath << "' kon niet geopend worden." << std::endl << std::endl;
+            Handler.SetOutputStream(&std::cout);
+        }
+        Function(Handler);
+        if (target.is_open())
+        {
+            target.close();
+        }
+        else
+        {
+            std::cout << std::endl << std::endl;
+        }
+    }
+}
+
+/// \brief Creates a parser for actions that save a board to the file
+/// that the action's argument names, with a UI handler that the
+/// given output handler function creates. The board to save is
+/// looked up with the given scene function whenever an action is
+/// parsed, so the action saves the board that is live at that
+/// time. Parsed actions do nothing when they are executed.
+std::shared_ptr<IParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>> Arcade::CreateSaveCommandParser(
+    std::function<std::shared_ptr<Board>()> Scene, std::function<std::shared_ptr<UIHandlerBase>()> OutputHandler)
+{
+    return LambdaParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>::make_shared([=](std::string val)
+    {
+        auto scene = Scene();
+        auto handler = OutputHandler();
+        WriteToFile(*handler, val, [=](UIHandlerBase& h)
+        {
+            h.Initialize(scene);
+        });
+
+        return EmptyCommand<std::shared_ptr<Board>>::GetInstance();
+    });
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <functional>
+#include <memory>
+#include <string>
+#include "Board.h"
+#include "ICommand.h"
+#include "IParser.h"
+#include "UIHandlerBase.h"
+
+namespace Arcade
+{
+    /// \brief Points the given UI handler at the file with the given path,
+    /// or at standard output if the path is empty, and runs the given
+    /// function on the handler. If the file cannot be opened, an error
+    /// is printed and the output goes to standard output instead.
+    void WriteToFile(UIHandlerBase& Handler, std::string FilePath, std::function<void(UIHandlerBase&)> Function);
+
+    /// \brief Creates a parser for actions that save a board to the file
+    /// that the action's argument names, with a UI handler that the
+    /// given output handler function creates. The board to save is
+    /// looked up with the given scene function whenever an action is
+    /// parsed, so the action saves the board that is live at that
+    /// time. Parsed actions do nothing when they are executed.
+    std::shared_ptr<IParser<std::string, std::shared_ptr<ICommand<std::shared_ptr<Board>>>>> CreateSaveCommandParser(
+        std::function<std::shared_ptr<Board>()> Scene, std::function<std::shared_ptr<UIHandlerBase>()> OutputHandler);
+}
@@ -0,0 +1,597 @@
+#include "Solver.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <ostream>
+#include <queue>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+#include "AttackCommand.h"
+#include "Board.h"
+#include "Button.h"
+#include "CommandStream.h"
+#include "Contracts.h"
+#include "DeadCellAnalysis.h"
+#include "Gate.h"
+#include "Goal.h"
+#include "MoveCommand.h"
+#include "Obstacle.h"
+#include "PieceBase.h"
+#include "PieceHandle.h"
+#include "Player.h"
+#include "TranspositionTable.h"
+#include "Vector2.h"
+#include "WorkStealingPool.h"
+
+using namespace Arcade;
+
+namespace
+{
+    /// \brief The directions in which an action can be performed: left,
+    /// right, up and down. Every direction is used for a move and
+    /// for an attack, in that order.
+    const Vector2<int> directions[] = { Vector2<int>(-1, 0), Vector2<int>(1, 0), Vector2<int>(0, 1), Vector2<int>(0, -1) };
+    const int directionCount = 4;
+
+    /// \brief Writes the given string to the given stream, escaping the
+    /// characters that XML reserves.
+    void WriteXmlText(std::ostream& Stream, const std::string& Value)
+    {
+        for (char c : Value)
+        {
+            switch (c)
+            {
+            case '<':
+                Stream << "&lt;";
+                break;
+            case '>':
+                Stream << "&gt;";
+                break;
+            case '&':
+                Stream << "&amp;";
+                break;
+            default:
+                Stream << c;
+                break;
+            }
+        }
+    }
+}
+
+/// \brief Gets the name of the given status.
+std::string Arcade::GetSolverStatusName(SolverStatus Value)
+{
+    switch (Value)
+    {
+    case SolverStatus::Solved:
+        return "solved";
+    case SolverStatus::Unsolvable:
+        return "unsolvable";
+    default:
+        return "limit";
+    }
+}
+
+/// \brief Creates a solver for the given board. The board itself
+/// is never modified.
+/// \pre require_cheap(Initial != nullptr);
+/// \post ensure_cheap(this->CheckInvariants());
+Solver::Solver(std::shared_ptr<Board> Initial)
+    : initial(Initial), deadCells(*Initial)
+{
+    require_cheap(Initial != nullptr);
+    // Actions refer to actors by name, so only the first player with
+    // a given name can be told to act.
+    for (auto& player : Initial->GetPlayers())
+    {
+        if (Initial->GetActorOrNull(player->GetName()) == player)
+        {
+            this->actors.push_back(player);
+            this->actorHandles.push_back(Initial->GetHandle(*player));
+        }
+    }
+
+    for (auto& piece : Initial->GetPieces())
+    {
+        bool isStatic = (typeid(*piece) == typeid(Obstacle) && !piece->GetMovable()) ||
+                        dynamic_cast<const Goal*>(piece.get()) != nullptr ||
+                        dynamic_cast<const Button*>(piece.get()) != nullptr ||
+                        dynamic_cast<const Gate*>(piece.get()) != nullptr;
+        if (!isStatic)
+            this->dynamicPieces.push_back(Initial->GetHandle(*piece));
+    }
+
+    for (auto& goal : Initial->GetGoals())
+        this->goals.push_back(goal->GetPosition());
+
+    // Cell zero stands for a removed piece.
+    this->useWideCells = (std::int64_t)Initial->GetWidth() * Initial->GetHeight() + 1 > 0xFFFF;
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Checks if this type's invariants are being respected.
+/// A boolean value is returned that indicates whether this is
+/// indeed the case. This method is publically visible, and can
+/// be used to verify an instance's state.
+bool Solver::CheckInvariants() const
+{
+    if (!this->isCheckingInvariants)
+    {
+        this->isCheckingInvariants = true;
+        bool result = this->initial != nullptr &&
+                      this->actors.size() == this->actorHandles.size();
+        this->isCheckingInvariants = false;
+        return result;
+    }
+    return true;
+}
+
+/// \brief Searches for a shortest winning sequence of actions.
+/// Both algorithms find a shortest sequence; A* usually visits
+/// fewer states.
+/// \pre require_cheap(Options.MaxStates > 0);
+/// \pre require_cheap(this->CheckInvariants());
+SolverResult Solver::Solve(const SolverOptions& Options) const
+{
+    require_cheap(Options.MaxStates > 0);
+    require_cheap(this->CheckInvariants());
+    if (this->goals.empty() || this->actors.empty() || this->initial->GetPlayers().size() == 0)
+    {
+        // There is nothing to search for. Checking this up front spares
+        // an exhaustive search of every reachable state.
+        SolverResult result;
+        result.Status = IsVictory(this->initial) ? SolverStatus::Solved : SolverStatus::Unsolvable;
+        result.ExpandedStates = 0;
+        result.VisitedStates = 1;
+        return result;
+    }
+    else if (Options.Algorithm == SolverAlgorithm::AStar)
+        return this->SolveAStar(Options);
+    else
+        return this->SolveBreadthFirst(Options);
+}
+
+/// \brief Searches for a shortest winning sequence of actions with
+/// breadth-first search, on the threads of the given pool. The
+/// states of each layer are expanded concurrently, and a layer
+/// is only started once the previous layer is done, so the
+/// sequence is as short as the one that Solve finds. The
+/// algorithm in the options is ignored. The transposition table
+/// is allocated up front, with room for MaxStates states.
+/// \remark States are told apart by a 64-bit hash, so two states
+/// whose hashes collide are taken to be the same state.
+/// \pre require_cheap(Options.MaxStates > 0);
+/// \pre require_cheap(this->CheckInvariants());
+SolverResult Solver::SolveParallel(const SolverOptions& Options, WorkStealingPool& Pool) const
+{
+    require_cheap(Options.MaxStates > 0);
+    require_cheap(this->CheckInvariants());
+    if (this->goals.empty() || this->actors.empty() || this->initial->GetPlayers().size() == 0)
+        return this->Solve(Options);
+
+    /// \brief Describes the outcome of expanding a single state.
+    struct Expansion
+    {
+        bool IsExpanded = false;
+        /// \brief The winning successor's slot, or -1.
+        int Victory = -1;
+        std::vector<std::pair<int, std::shared_ptr<Board>>> Successors;
+    };
+
+    SolverResult result;
+    result.Status = SolverStatus::Unsolvable;
+    result.ExpandedStates = 0;
+
+    // Nodes are stored by the slot of their state in the table. A slot
+    // is claimed by exactly one thread, which is the only thread that
+    // writes its node.
+    TranspositionTable visited(std::min(Options.MaxStates, TranspositionTable::MaxCapacity));
+    std::vector<Node> nodes(visited.GetSlotCount());
+    std::vector<std::pair<int, std::shared_ptr<Board>>> frontier;
+    auto root = this->initial->Fork();
+    bool isNew;
+    int rootSlot = visited.Insert(this->HashState(*root), isNew);
+    nodes[rootSlot] = Node { -1, 0, -1, -1 };
+    int found = -1;
+    if (IsVictory(root))
+        found = rootSlot;
+    else
+        frontier.emplace_back(rootSlot, root);
+
+    int actionCount = GetActionCount(Options);
+    std::atomic<bool> isVictoryFound(false);
+    std::atomic<bool> isLimitReached(false);
+    while (!frontier.empty() && found < 0 && !isLimitReached.load())
+    {
+        // Any victory in a layer is a shortest one, so once a thread has
+        // found one, the remaining states of the layer can be skipped.
+        std::vector<Expansion> expansions(frontier.size());
+        Pool.Run((int)frontier.size(), [&](int Index)
+        {
+            if (isVictoryFound.load(std::memory_order_relaxed))
+                return;
+
+            auto& state = frontier[Index];
+            auto& expansion = expansions[Index];
+            expansion.IsExpanded = true;
+            for (int actor = 0; actor < (int)this->actors.size(); actor++)
+            {
+                for (int action = 0; action < actionCount; action++)
+                {
+                    std::shared_ptr<Board> next;
+                    if (!this->TryAction(*state.second, actor, action, Options, next))
+                        continue;
+
+                    bool isNewState;
+                    int slot = visited.Insert(this->HashState(*next), isNewState);
+                    if (!isNewState)
+                        continue;
+                    else if (slot < 0)
+                    {
+                        isLimitReached.store(true, std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    nodes[slot] = Node { state.first, nodes[state.first].Depth + 1, actor, action };
+                    if (IsVictory(next))
+                    {
+                        expansion.Victory = slot;
+                        isVictoryFound.store(true, std::memory_order_relaxed);
+                        return;
+                    }
+                    expansion.Successors.emplace_back(slot, std::move(next));
+                }
+            }
+        });
+
+        // Merge the successors in the order of their parents, so the
+        // next layer is laid out much like a serial search lays it out.
+        std::vector<std::pair<int, std::shared_ptr<Board>>> nextFrontier;
+        for (auto& expansion : expansions)
+        {
+            if (expansion.IsExpanded)
+                result.ExpandedStates++;
+            if (found < 0 && expansion.Victory >= 0)
+                found = expansion.Victory;
+            for (auto& successor : expansion.Successors)
+                nextFrontier.push_back(std::move(successor));
+        }
+        frontier.swap(nextFrontier);
+    }
+
+    if (found >= 0)
+    {
+        result.Status = SolverStatus::Solved;
+        result.Actions = this->GetPath(nodes, found);
+    }
+    else if (isLimitReached.load())
+        result.Status = SolverStatus::LimitReached;
+    result.VisitedStates = visited.GetCount();
+    return result;
+}
+
+/// \brief Encodes the given state of the solver's board. Two
+/// states have the same encoding if and only if every piece
+/// that can move or be removed is in the same cell. The given
+/// board must be the solver's board or one of its forks.
+/// \pre require_cheap(this->CheckInvariants());
+std::string Solver::EncodeState(const Board& Scene) const
+{
+    require_cheap(this->CheckInvariants());
+    int cellSize = this->useWideCells ? 4 : 2;
+    std::string result(this->dynamicPieces.size() * cellSize, '\0');
+    int width = Scene.GetWidth();
+    for (size_t i = 0; i < this->dynamicPieces.size(); i++)
+    {
+        auto piece = Scene.GetPiece(this->dynamicPieces[i]);
+        std::uint32_t cell = 0;
+        if (piece != nullptr)
+            cell = piece->GetPosition().Y * width + piece->GetPosition().X + 1;
+        for (int j = 0; j < cellSize; j++)
+            result[i * cellSize + j] = (char)(cell >> (8 * j));
+    }
+    return result;
+}
+
+/// \brief Gets the smallest Manhattan distance between a player
+/// and a goal on the given board. This is a lower bound on the
+/// number of actions that it takes to win. If there are no
+/// players, -1 is returned.
+/// \pre require_cheap(this->CheckInvariants());
+int Solver::EstimateDistance(const Board& Scene) const
+{
+    require_cheap(this->CheckInvariants());
+    // Every action moves at most one player by at most one cell.
+    int result = -1;
+    for (auto& player : Scene.GetPlayers())
+    {
+        auto position = player->GetPosition();
+        for (auto& goal : this->goals)
+        {
+            int distance = std::abs(goal.X - position.X) + std::abs(goal.Y - position.Y);
+            if (result < 0 || distance < result)
+                result = distance;
+        }
+    }
+    return result;
+}
+
+/// \brief Gets the board that this solver solves.
+/// \pre require_cheap(this->CheckInvariants());
+std::shared_ptr<Board> Solver::GetInitialBoard() const
+{
+    require_cheap(this->CheckInvariants());
+    return this->initial;
+}
+
+/// \brief Gets a boolean value that tells if a player has reached
+/// a goal on the given board.
+bool Solver::IsVictory(const std::shared_ptr<Board>& Scene)
+{
+    // This is the same verdict that UIHandlerBase::GetPlayerHasWon
+    // arrives at.
+    for (auto& goal : Scene->GetGoals())
+        for (auto& player : Scene->GetPlayers())
+            if (goal->IsPlayerVictorious(Scene, player))
+                return true;
+    return false;
+}
+
+/// \brief Applies the given action of the given player to a fork
+/// of the given board. A boolean is returned that tells if the
+/// action has changed the board, has left at least one player
+/// on it, and has not been pruned.
+bool Solver::TryAction(const Board& Scene, int Actor, int Action, const SolverOptions& Options, std::shared_ptr<Board>& Result) const
+{
+    auto handle = this->actorHandles[Actor];
+    if (!Scene.HasPiece(handle))
+        return false;
+
+    auto direction = directions[Action % directionCount];
+    if (Options.PruneDeadPushes && Action < directionCount &&
+        this->deadCells.ClassifyPush(Scene, handle, direction) == PushVerdict::Dead)
+        return false;
+
+    Result = Scene.Fork();
+    bool succeeded = Action < directionCount
+        ? MoveCommand::Apply(*Result, handle, direction)
+        : AttackCommand::Apply(*Result, handle, direction);
+    return succeeded &&
+           Result->GetStateHash() != Scene.GetStateHash() &&
+           Result->GetPlayers().size() > 0;
+}
+
+/// \brief Gets a 64-bit hash of the given state of the solver's
+/// board. Unlike the board's own state hash, this hash tells
+/// the players apart.
+std::uint64_t Solver::HashState(const Board& Scene) const
+{
+    // The board hashes pieces by type and position only, which does not
+    // distinguish two players that have swapped places. Actions refer
+    // to players by name, so mix in the cell of every actor as well.
+    std::uint64_t result = Scene.GetStateHash();
+    for (auto& handle : this->actorHandles)
+    {
+        auto piece = Scene.GetPiece(handle);
+        std::uint64_t cell = 0;
+        if (piece != nullptr)
+            cell = (std::uint64_t)piece->GetPosition().Y * Scene.GetWidth() + piece->GetPosition().X + 1;
+        result = (result ^ cell) * 1099511628211ull;
+    }
+    return result ^ (result >> 32);
+}
+
+/// \brief Gets the number of actions in the action table that
+/// the given options allow.
+int Solver::GetActionCount(const SolverOptions& Options)
+{
+    return Options.AllowAttacks ? directionCount * 2 : directionCount;
+}
+
+/// \brief Gets the actions that lead to the given node.
+CommandStream Solver::GetPath(const std::vector<Node>& Nodes, int Index) const
+{
+    std::vector<int> path;
+    for (int i = Index; Nodes[i].Parent >= 0; i = Nodes[i].Parent)
+        path.push_back(i);
+
+    CommandStream result;
+    for (auto i = path.rbegin(); i != path.rend(); ++i)
+    {
+        auto& node = Nodes[*i];
+        auto kind = node.Action < directionCount ? ActionKind::Move : ActionKind::Attack;
+        result.Append(kind, this->actors[node.Actor], directions[node.Action % directionCount]);
+    }
+    return result;
+}
+
+/// \brief Searches for a shortest winning sequence of actions with
+/// breadth-first search.
+SolverResult Solver::SolveBreadthFirst(const SolverOptions& Options) const
+{
+    SolverResult result;
+    result.Status = SolverStatus::Unsolvable;
+    result.ExpandedStates = 0;
+
+    std::vector<Node> nodes;
+    std::unordered_map<std::string, int> visited;
+    std::queue<std::pair<int, std::shared_ptr<Board>>> frontier;
+    auto root = this->initial->Fork();
+    nodes.push_back(Node { -1, 0, -1, -1 });
+    visited.emplace(this->EncodeState(*root), 0);
+    if (IsVictory(root))
+        result.Status = SolverStatus::Solved;
+    else
+        frontier.emplace(0, root);
+
+    // Breadth-first search reaches every state along a shortest path
+    // first, so a victory can be reported as soon as it is generated.
+    int actionCount = GetActionCount(Options);
+    while (!frontier.empty() && result.Status == SolverStatus::Unsolvable)
+    {
+        int index = frontier.front().first;
+        auto scene = std::move(frontier.front().second);
+        frontier.pop();
+        result.ExpandedStates++;
+        for (int actor = 0; actor < (int)this->actors.size() && result.Status == SolverStatus::Unsolvable; actor++)
+        {
+            for (int action = 0; action < actionCount; action++)
+            {
+                std::shared_ptr<Board> next;
+                if (!this->TryAction(*scene, actor, action, Options, next))
+                    continue;
+
+                if (!visited.emplace(this->EncodeState(*next), (int)nodes.size()).second)
+                    continue;
+
+                nodes.push_back(Node { index, nodes[index].Depth + 1, actor, action });
+                if (IsVictory(next))
+                {
+                    result.Status = SolverStatus::Solved;
+                    break;
+                }
+                if ((int)nodes.size() >= Options.MaxStates)
+                {
+                    result.Status = SolverStatus::LimitReached;
+                    break;
+                }
+                frontier.emplace((int)nodes.size() - 1, std::move(next));
+            }
+        }
+    }
+
+    if (result.Status == SolverStatus::Solved)
+        result.Actions = this->GetPath(nodes, (int)nodes.size() - 1);
+    result.VisitedStates = (int)nodes.size();
+    return result;
+}
+
+/// \brief Searches for a shortest winning sequence of actions with
+/// A* search.
+SolverResult Solver::SolveAStar(const SolverOptions& Options) const
+{
+    SolverResult result;
+    result.Status = SolverStatus::Unsolvable;
+    result.ExpandedStates = 0;
+
+    /// \brief Describes a state that is yet to be expanded.
+    struct OpenState
+    {
+        int Estimate;
+        int Depth;
+        int Node;
+        std::shared_ptr<Board> Scene;
+
+        /// \brief Orders states by estimated total cost and then, on a
+        /// tie, prefers the deeper state, which is closer to a goal.
+        bool operator<(const OpenState& Other) const
+        {
+            if (this->Estimate != Other.Estimate)
+                return this->Estimate > Other.Estimate;
+            return this->Depth < Other.Depth;
+        }
+    };
+
+    std::vector<Node> nodes;
+    std::unordered_map<std::string, int> visited;
+    std::priority_queue<OpenState> open;
+    auto root = this->initial->Fork();
+    nodes.push_back(Node { -1, 0, -1, -1 });
+    visited.emplace(this->EncodeState(*root), 0);
+    open.push(OpenState { this->EstimateDistance(*root), 0, 0, root });
+
+    // The estimate is consistent, so a state's depth is final once it
+    // is expanded. A state that is reached again along a shorter path
+    // before then is queued again, and the stale entry is skipped.
+    int actionCount = GetActionCount(Options);
+    int found = -1;
+    while (!open.empty())
+    {
+        auto state = open.top();
+        open.pop();
+        if (state.Depth != nodes[state.Node].Depth)
+            continue;
+
+        if (IsVictory(state.Scene))
+        {
+            found = state.Node;
+            break;
+        }
+
+        result.ExpandedStates++;
+        for (int actor = 0; actor < (int)this->actors.size(); actor++)
+        {
+            for (int action = 0; action < actionCount; action++)
+            {
+                std::shared_ptr<Board> next;
+                if (!this->TryAction(*state.Scene, actor, action, Options, next))
+                    continue;
+
+                int depth = state.Depth + 1;
+                auto entry = visited.emplace(this->EncodeState(*next), (int)nodes.size());
+                int index = entry.first->second;
+                if (entry.second)
+                {
+                    if ((int)nodes.size() >= Options.MaxStates)
+                    {
+                        visited.erase(entry.first);
+                        result.Status = SolverStatus::LimitReached;
+                        continue;
+                    }
+                    nodes.push_back(Node { state.Node, depth, actor, action });
+                }
+                else if (depth < nodes[index].Depth)
+                    nodes[index] = Node { state.Node, depth, actor, action };
+                else
+                    continue;
+
+                open.push(OpenState { depth + this->EstimateDistance(*next), depth, index, std::move(next) });
+            }
+        }
+        if (result.Status == SolverStatus::LimitReached)
+            break;
+    }
+
+    if (found >= 0)
+    {
+        result.Status = SolverStatus::Solved;
+        result.Actions = this->GetPath(nodes, found);
+    }
+    result.VisitedStates = (int)nodes.size();
+    return result;
+}
+
+/// \brief Writes the given actions to the given stream as an ACTIES
+/// document, which parseMoves can read.
+void Arcade::WriteActionsXml(std::ostream& Stream, const CommandStream& Actions)
+{
+    Stream << "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n";
+    Stream << "<ACTIES>\n";
+    for (int i = 0; i < Actions.GetLength(); i++)
+    {
+        auto command = Actions.GetCommand(i);
+        auto tag = command.Kind == ActionKind::Move ? "BEWEGING" : "AANVAL";
+        const char* direction;
+        if (command.OffsetX < 0)
+            direction = "LINKS";
+        else if (command.OffsetX > 0)
+            direction = "RECHTS";
+        else if (command.OffsetY > 0)
+            direction = "OMHOOG";
+        else
+            direction = "OMLAAG";
+
+        Stream << "    <" << tag << ">\n";
+        Stream << "        <ID>";
+        WriteXmlText(Stream, Actions.GetActor(i)->GetName());
+        Stream << "</ID>\n";
+        Stream << "        <RICHTING>" << direction << "</RICHTING>\n";
+        Stream << "    </" << tag << ">\n";
+    }
+    Stream << "</ACTIES>\n";
+}
@@ -0,0 +1,202 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Board.h"
+#include "CommandStream.h"
+#include "Contracts.h"
+#include "DeadCellAnalysis.h"
+#include "PieceHandle.h"
+#include "Vector2.h"
+#include "WorkStealingPool.h"
+
+namespace Arcade
+{
+    struct Player;
+
+    /// \brief Enumerates the search strategies that a solver can use.
+    enum class SolverAlgorithm
+    {
+        /// \brief Breadth-first search.
+        BreadthFirst,
+        /// \brief A* search, guided by the players' distance to the
+        /// nearest goal.
+        AStar
+    };
+
+    /// \brief Enumerates the ways in which a search can end.
+    enum class SolverStatus
+    {
+        /// \brief A shortest winning sequence of actions has been found.
+        Solved,
+        /// \brief Every reachable state has been visited, and none of
+        /// them is a victory.
+        Unsolvable,
+        /// \brief The search has visited the maximal number of states
+        /// without finding a victory.
+        LimitReached
+    };
+
+    /// \brief Describes how a solver searches.
+    struct SolverOptions
+    {
+        SolverAlgorithm Algorithm = SolverAlgorithm::AStar;
+        /// \brief The maximal number of distinct states to visit.
+        int MaxStates = 1000000;
+        /// \brief Tells if the solver may attack, in addition to moving.
+        bool AllowAttacks = true;
+        /// \brief Tells if the solver skips pushes that leave a barrel
+        /// stuck in a place that walls every player off from every
+        /// goal. Such states can never be won, so skipping them does
+        /// not change the solution.
+        bool PruneDeadPushes = true;
+    };
+
+    /// \brief Describes the outcome of a search.
+    struct SolverResult
+    {
+        SolverStatus Status;
+        /// \brief The winning actions, if the board has been solved.
+        CommandStream Actions;
+        /// \brief The number of states whose successors have been
+        /// generated.
+        int ExpandedStates;
+        /// \brief The number of distinct states that have been visited.
+        int VisitedStates;
+    };
+
+    /// \brief Gets the name of the given status.
+    std::string GetSolverStatusName(SolverStatus Value);
+
+    /// \brief Searches for the shortest sequence of player actions that
+    /// wins the game on a board. The search applies the real move and
+    /// attack semantics to copy-on-write forks of the board, so pushed
+    /// barrels, filled water, traps and gates all behave as they do
+    /// in the game. Every player can act; monsters stay put. States
+    /// are deduplicated by a compact encoding of the positions of the
+    /// pieces that can move or be removed. Pushes that leave a barrel
+    /// stuck where it cuts the players off from the goals are pruned
+    /// with a DeadCellAnalysis of the board. A parallel search spreads
+    /// the expansion of every breadth-first layer across the threads
+    /// of a pool, and deduplicates states by hash in a lock-free
+    /// transposition table instead.
+    class Solver
+    {
+    public:
+        /// \brief Creates a solver for the given board. The board itself
+        /// is never modified.
+        /// \pre require_cheap(Initial != nullptr);
+        /// \post ensure_cheap(this->CheckInvariants());
+        explicit Solver(std::shared_ptr<Board> Initial);
+
+        /// \brief Checks if this type's invariants are being respected.
+        /// A boolean value is returned that indicates whether this is
+        /// indeed the case. This method is publically visible, and can
+        /// be used to verify an instance's state.
+        bool CheckInvariants() const;
+
+        /// \brief Searches for a shortest winning sequence of actions.
+        /// Both algorithms find a shortest sequence; A* usually visits
+        /// fewer states.
+        /// \pre require_cheap(Options.MaxStates > 0);
+        /// \pre require_cheap(this->CheckInvariants());
+        SolverResult Solve(const SolverOptions& Options) const;
+
+        /// \brief Searches for a shortest winning sequence of actions with
+        /// breadth-first search, on the threads of the given pool. The
+        /// states of each layer are expanded concurrently, and a layer
+        /// is only started once the previous layer is done, so the
+        /// sequence is as short as the one that Solve finds. The
+        /// algorithm in the options is ignored. The transposition table
+        /// is allocated up front, with room for MaxStates states.
+        /// \remark States are told apart by a 64-bit hash, so two states
+        /// whose hashes collide are taken to be the same state.
+        /// \pre require_cheap(Options.MaxStates > 0);
+        /// \pre require_cheap(this->CheckInvariants());
+        SolverResult SolveParallel(const SolverOptions& Options, WorkStealingPool& Pool) const;
+
+        /// \brief Encodes the given state of the solver's board. Two
+        /// states have the same encoding if and only if every piece
+        /// that can move or be removed is in the same cell. The given
+        /// board must be the solver's board or one of its forks.
+        /// \pre require_cheap(this->CheckInvariants());
+        std::string EncodeState(const Board& Scene) const;
+
+        /// \brief Gets the smallest Manhattan distance between a player
+        /// and a goal on the given board. This is a lower bound on the
+        /// number of actions that it takes to win. If there are no
+        /// players, -1 is returned.
+        /// \pre require_cheap(this->CheckInvariants());
+        int EstimateDistance(const Board& Scene) const;
+
+        /// \brief Gets the board that this solver solves.
+        /// \pre require_cheap(this->CheckInvariants());
+        std::shared_ptr<Board> GetInitialBoard() const;
+
+        /// \brief Gets a boolean value that tells if a player has reached
+        /// a goal on the given board.
+        static bool IsVictory(const std::shared_ptr<Board>& Scene);
+    private:
+        /// \brief Describes a visited state, by the action that first
+        /// led to it.
+        struct Node
+        {
+            /// \brief The index of the node that this node's state was
+            /// reached from, or -1.
+            int Parent;
+            /// \brief The number of actions from the initial state.
+            int Depth;
+            /// \brief The index of the acting player in the solver's
+            /// player table.
+            int Actor;
+            /// \brief The index of the action in the action table.
+            int Action;
+        };
+
+        /// \brief Applies the given action of the given player to a fork
+        /// of the given board. A boolean is returned that tells if the
+        /// action has changed the board, has left at least one player
+        /// on it, and has not been pruned.
+        bool TryAction(const Board& Scene, int Actor, int Action, const SolverOptions& Options, std::shared_ptr<Board>& Result) const;
+
+        /// \brief Gets a 64-bit hash of the given state of the solver's
+        /// board. Unlike the board's own state hash, this hash tells
+        /// the players apart.
+        std::uint64_t HashState(const Board& Scene) const;
+
+        /// \brief Gets the number of actions in the action table that
+        /// the given options allow.
+        static int GetActionCount(const SolverOptions& Options);
+
+        /// \brief Gets the actions that lead to the given node.
+        CommandStream GetPath(const std::vector<Node>& Nodes, int Index) const;
+
+        /// \brief Searches for a shortest winning sequence of actions with
+        /// breadth-first search.
+        SolverResult SolveBreadthFirst(const SolverOptions& Options) const;
+
+        /// \brief Searches for a shortest winning sequence of actions with
+        /// A* search.
+        SolverResult SolveAStar(const SolverOptions& Options) const;
+
+        mutable bool isCheckingInvariants = false;
+        std::shared_ptr<Board> initial;
+        /// \brief The players that can act, i.e. the players that an
+        /// action file can refer to by name.
+        std::vector<std::shared_ptr<Player>> actors;
+        std::vector<PieceHandle> actorHandles;
+        /// \brief The pieces whose positions make up a state: every piece
+        /// except walls, goals, buttons and gates, which never change.
+        std::vector<PieceHandle> dynamicPieces;
+        std::vector<Vector2<int>> goals;
+        /// \brief Tells if cells are encoded in four bytes rather than two.
+        bool useWideCells;
+        DeadCellAnalysis deadCells;
+    };
+
+    /// \brief Writes the given actions to the given stream as an ACTIES
+    /// document, which parseMoves can read.
+    void WriteActionsXml(std::ostream& Stream, const CommandStream& Actions);
+}
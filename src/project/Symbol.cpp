@@ -0,0 +1,75 @@
+#include "Symbol.h"
+
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_set>
+
+using namespace Arcade;
+
+namespace
+{
+    /// \brief Describes the process-wide symbol table. Its entries are
+    /// never removed, and the nodes of an unordered set stay put
+    /// when the set grows, so symbols can point straight at them.
+    struct SymbolTable
+    {
+        std::mutex Lock;
+        std::unordered_set<std::string> Entries;
+    };
+
+    SymbolTable& GetSymbolTable()
+    {
+        static SymbolTable table;
+        return table;
+    }
+}
+
+/// \brief Creates a symbol for the empty string.
+Symbol::Symbol()
+{
+    static const std::string* empty = Intern(std::string());
+    this->text = empty;
+}
+
+/// \brief Creates a symbol for the given string, and adds the
+/// string to the symbol table if it is not in there yet.
+Symbol::Symbol(const std::string& Text)
+    : text(Intern(Text))
+{ }
+
+/// \brief Creates a symbol for the given string, and adds the
+/// string to the symbol table if it is not in there yet.
+Symbol::Symbol(const char* Text)
+    : text(Intern(Text))
+{ }
+
+/// \brief Finds the symbol for the given string, without adding
+/// the string to the symbol table. A boolean is returned that
+/// tells if the string has been interned.
+bool Symbol::TryFind(const std::string& Text, Symbol& Result)
+{
+    auto& table = GetSymbolTable();
+    std::lock_guard<std::mutex> guard(table.Lock);
+    auto entry = table.Entries.find(Text);
+    if (entry == table.Entries.end())
+        return false;
+
+    Result = Symbol(&*entry);
+    return true;
+}
+
+/// \brief Gets the symbol table entry for the given string.
+const std::string* Symbol::Intern(const std::string& Text)
+{
+    auto& table = GetSymbolTable();
+    std::lock_guard<std::mutex> guard(table.Lock);
+    return &*table.Entries.insert(Text).first;
+}
+
+/// \brief Writes the string that the given symbol stands for to the
+/// given output stream.
+std::ostream& Arcade::operator<<(std::ostream& Stream, Symbol Value)
+{
+    return Stream << Value.GetText();
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+
+namespace Arcade
+{
+    /// \brief Represents an interned string, such as a piece's name or
+    /// an obstacle's type. Every distinct string is stored once, in a
+    /// process-wide symbol table, so symbols are the size of a pointer
+    /// and can be compared and hashed in constant time. Interning is
+    /// thread-safe.
+    class Symbol
+    {
+    public:
+        /// \brief Creates a symbol for the empty string.
+        Symbol();
+
+        /// \brief Creates a symbol for the given string, and adds the
+        /// string to the symbol table if it is not in there yet.
+        Symbol(const std::string& Text);
+
+        /// \brief Creates a symbol for the given string, and adds the
+        /// string to the symbol table if it is not in there yet.
+        Symbol(const char* Text);
+
+        /// \brief Finds the symbol for the given string, without adding
+        /// the string to the symbol table. A boolean is returned that
+        /// tells if the string has been interned.
+        static bool TryFind(const std::string& Text, Symbol& Result);
+
+        /// \brief Gets the string that this symbol stands for.
+        const std::string& GetText() const { return *this->text; }
+
+        /// \brief Gets the string that this symbol stands for.
+        operator const std::string&() const { return *this->text; }
+
+        /// \brief Checks if this symbol equals the given symbol.
+        bool operator==(Symbol Other) const { return this->text == Other.text; }
+
+        /// \brief Checks if this symbol is not equal to the given symbol.
+        bool operator!=(Symbol Other) const { return this->text != Other.text; }
+    private:
+        /// \brief Creates a symbol from the given symbol table entry.
+        explicit Symbol(const std::string* Text) : text(Text) { }
+
+        /// \brief Gets the symbol table entry for the given string.
+        static const std::string* Intern(const std::string& Text);
+
+        const std::string* text;
+
+        friend struct std::hash<Symbol>;
+    };
+
+    /// \brief Writes the string that the given symbol stands for to the
+    /// given output stream.
+    std::ostream& operator<<(std::ostream& Stream, Symbol Value);
+}
+
+namespace std
+{
+    template<>
+    struct hash<Arcade::Symbol>
+    {
+        std::size_t operator()(Arcade::Symbol Value) const
+        {
+            return std::hash<const std::string*>()(Value.text);
+        }
+    };
+}
@@ -119,7 +119,7 @@ namespace Arcade
 		handler.Initialize(board);
 		EXPECT_TRUE(CheckBoardEquality(initialBoardOutput, BoardPath));
 
-		for (auto move : moves)
+		for (auto& move : moves)
 		{
 			move->Execute(board);
 		}
@@ -188,7 +188,7 @@ namespace Arcade
 		std::stringstream expectedBoardOutput;
 		handler.SetOutputStream(&expectedBoardOutput);
 
-		for (auto move : moves)
+		for (auto& move : moves)
 		{
 			move->Execute(board);
 			handler.Display();
@@ -24,28 +24,28 @@ using namespace Arcade;
 /// \brief Creates a new textual UI handler from the given output
 /// stream, error stream and a boolean that indicates whether
 /// commands should be applied right away or stored.
-/// \pre require(outputStream != nullptr);
-/// \pre require(errorStream != nullptr);
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(outputStream != nullptr);
+/// \pre require_cheap(errorStream != nullptr);
+/// \post ensure_cheap(this->CheckInvariants());
 TextUIHandler::TextUIHandler(std::ostream* outputStream, std::ostream* errorStream, bool ApplyCommands)
     : UIHandlerBase(outputStream), errorStream(errorStream)
 {
-    require(outputStream != nullptr);
-    require(errorStream != nullptr);
+    require_cheap(outputStream != nullptr);
+    require_cheap(errorStream != nullptr);
     this->SetApplyCommands(ApplyCommands);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Applies a command to the board.
-/// \pre require(Command != nullptr);
-/// \pre require(this->GetIsInitialized());
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Command != nullptr);
+/// \pre require_cheap(this->GetIsInitialized());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void TextUIHandler::Apply(std::shared_ptr<ICommand<std::shared_ptr<Board>>> Command)
 {
-    require(Command != nullptr);
-    require(this->GetIsInitialized());
-    require(this->CheckInvariants());
+    require_cheap(Command != nullptr);
+    require_cheap(this->GetIsInitialized());
+    require_cheap(this->CheckInvariants());
     if (this->GetApplyCommands())
     {
         if (!Command->Execute(this->board))
@@ -57,7 +57,7 @@ void TextUIHandler::Apply(std::shared_ptr<ICommand<std::shared_ptr<Board>>> Comm
     {
         this->Display(Command);
     }
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Checks if this type's invariants are being respected.
@@ -72,13 +72,13 @@ bool TextUIHandler::CheckInvariantsCore() const
 }
 
 /// \brief Displays the board.
-/// \pre require(this->GetIsInitialized());
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->GetIsInitialized());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void TextUIHandler::Display()
 {
-    require(this->GetIsInitialized());
-    require(this->CheckInvariants());
+    require_cheap(this->GetIsInitialized());
+    require_cheap(this->CheckInvariants());
     *this->outputStream << 
         "Het huidige speelveld is " << this->board->GetName() << 
         ":\n";
@@ -92,14 +92,14 @@ void TextUIHandler::Display()
         *this->outputStream << "\n\n";
         this->Display(item);
     }
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Prints a generic command.
-/// \pre require(Command != nullptr);
+/// \pre require_cheap(Command != nullptr);
 void TextUIHandler::Display(std::shared_ptr<ICommand<std::shared_ptr<Board>>> Command)
 {
-    require(Command != nullptr);
+    require_cheap(Command != nullptr);
     if (stdx::isinstance<MoveCommand>(Command))
     {
         auto moveCmd = std::dynamic_pointer_cast<MoveCommand>(Command);
@@ -119,10 +119,10 @@ void TextUIHandler::Display(std::shared_ptr<ICommand<std::shared_ptr<Board>>> Co
 }
 
 /// \brief Prints a move command.
-/// \pre require(Command != nullptr);
+/// \pre require_cheap(Command != nullptr);
 void TextUIHandler::Display(std::shared_ptr<MoveCommand> Command)
 {
-    require(Command != nullptr);
+    require_cheap(Command != nullptr);
     if (stdx::isinstance<Player>(Command->GetTarget()))
         *this->outputStream << "Speler ";
     else
@@ -134,10 +134,10 @@ void TextUIHandler::Display(std::shared_ptr<MoveCommand> Command)
 }
 
 /// \brief Prints an attack command.
-/// \pre require(Command != nullptr);
+/// \pre require_cheap(Command != nullptr);
 void TextUIHandler::Display(std::shared_ptr<AttackCommand> Command)
 {
-    require(Command != nullptr);
+    require_cheap(Command != nullptr);
     if (stdx::isinstance<Player>(Command->GetTarget()))
         *this->outputStream << "Speler ";
     else
@@ -149,10 +149,10 @@ void TextUIHandler::Display(std::shared_ptr<AttackCommand> Command)
 }
 
 /// \brief Prints a piece's information.
-/// \pre require(Piece != nullptr);
+/// \pre require_cheap(Piece != nullptr);
 void TextUIHandler::Display(std::shared_ptr<PieceBase> Piece)
 {
-    require(Piece != nullptr);
+    require_cheap(Piece != nullptr);
     if (stdx::isinstance<Player>(Piece))
         this->Display(std::dynamic_pointer_cast<Player>(Piece));
     else if (stdx::isinstance<Monster>(Piece))
@@ -173,42 +173,42 @@ void TextUIHandler::Display(std::shared_ptr<PieceBase> Piece)
 }
 
 /// \brief Prints a player piece's status.
-/// \pre require(Piece != nullptr);
+/// \pre require_cheap(Piece != nullptr);
 void TextUIHandler::Display(std::shared_ptr<Player> Piece)
 {
-    require(Piece != nullptr);
+    require_cheap(Piece != nullptr);
     *this->outputStream << "Speler " << Piece->GetName() << 
                            " bevindt zich in dit speeldveld op positie " << 
                            Piece->GetPosition() << ".";
 }
 
 /// \brief Prints a monster piece's status.
-/// \pre require(Piece != nullptr);
+/// \pre require_cheap(Piece != nullptr);
 void TextUIHandler::Display(std::shared_ptr<Monster> Piece)
 {
-    require(Piece != nullptr);
+    require_cheap(Piece != nullptr);
     *this->outputStream << 
         "Er bevindt zich een monster op positie " << 
         Piece->GetPosition() << ".";
 }
 
 /// \brief Prints a gate piece's status.
-/// \pre require(Piece != nullptr);
+/// \pre require_cheap(Piece != nullptr);
 void TextUIHandler::Display(std::shared_ptr<Gate> Piece)
 {
-    require(Piece != nullptr);
+    require_cheap(Piece != nullptr);
     *this->outputStream << 
         "Er bevindt zich een poort (met id " << Piece->GetName() << 
         ") op positie " << Piece->GetPosition() << ".";
 }
 
 /// \brief Prints a button piece's status.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->GetIsInitialized());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->GetIsInitialized());
 void TextUIHandler::Display(std::shared_ptr<Button> Piece)
 {
-    require(Piece != nullptr);
-    require(this->GetIsInitialized());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->GetIsInitialized());
     auto gate = Piece->GetAssociatedGate(this->board);
     if (gate != nullptr)
         *this->outputStream << 
@@ -220,20 +220,20 @@ void TextUIHandler::Display(std::shared_ptr<Button> Piece)
 }
 
 /// \brief Prints a water piece's status.
-/// \pre require(Piece != nullptr);
+/// \pre require_cheap(Piece != nullptr);
 void TextUIHandler::Display(std::shared_ptr<Water> Piece)
 {
-    require(Piece != nullptr);
+    require_cheap(Piece != nullptr);
     *this->outputStream << 
         "Er bevindt zich " << Piece->GetObstacleType() << 
         " op positie " << Piece->GetPosition() << ".";
 }
 
 /// \brief Prints an obstacle piece's status.
-/// \pre require(Piece != nullptr);
+/// \pre require_cheap(Piece != nullptr);
 void TextUIHandler::Display(std::shared_ptr<Obstacle> Piece)
 {
-    require(Piece != nullptr);
+    require_cheap(Piece != nullptr);
     *this->outputStream << 
         "Er bevindt zich een " << Piece->GetObstacleType() << 
         " op positie " << Piece->GetPosition() << ".";
@@ -259,24 +259,24 @@ void TextUIHandler::DisplayOffset(Vector2<int> Offset)
 /// applied. The resulting behavior is exactly the same as
 /// setting 'ApplyCommands' to false during object
 /// construction.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(!this->GetApplyCommands());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(!this->GetApplyCommands());
+/// \post ensure_cheap(this->CheckInvariants());
 void TextUIHandler::Freeze()
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     this->SetApplyCommands(false);
-    ensure(!this->GetApplyCommands());
-    ensure(this->CheckInvariants());
+    ensure_cheap(!this->GetApplyCommands());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Gets a boolean flag that indicates whether incoming
 /// commands will be applied to the board or written to an
 /// output stream.
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
 bool TextUIHandler::GetApplyCommands() const
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     return this->ApplyCommands_value;
 }
 
@@ -288,20 +288,20 @@ void TextUIHandler::SetApplyCommands(bool value)
     this->ApplyCommands_value = value;
 }
 
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
 std::ostream* TextUIHandler::GetErrorStream() const
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     return this->errorStream;
 }
 
-/// \pre require(value != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(value != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void TextUIHandler::SetErrorStream(std::ostream* value)
 {
-    require(value != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(value != nullptr);
+    require_cheap(this->CheckInvariants());
     this->errorStream = value;
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
\ No newline at end of file
@@ -26,44 +26,44 @@ namespace Arcade
         /// \brief Creates a new textual UI handler from the given output
         /// stream, error stream and a boolean that indicates whether
         /// commands should be applied right away or stored.
-        /// \pre require(outputStream != nullptr);
-        /// \pre require(errorStream != nullptr);
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(outputStream != nullptr);
+        /// \pre require_cheap(errorStream != nullptr);
+        /// \post ensure_cheap(this->CheckInvariants());
         TextUIHandler(std::ostream* outputStream, std::ostream* errorStream, bool ApplyCommands);
 
         /// \brief Applies a command to the board.
-        /// \pre require(Command != nullptr);
-        /// \pre require(this->GetIsInitialized());
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Command != nullptr);
+        /// \pre require_cheap(this->GetIsInitialized());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void Apply(std::shared_ptr<ICommand<std::shared_ptr<Board>>> Command) override;
 
         /// \brief Displays the board.
-        /// \pre require(this->GetIsInitialized());
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->GetIsInitialized());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void Display() override;
 
         /// \brief "Freezes" the board: new command will no longer be
         /// applied. The resulting behavior is exactly the same as
         /// setting 'ApplyCommands' to false during object
         /// construction.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(!this->GetApplyCommands());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(!this->GetApplyCommands());
+        /// \post ensure_cheap(this->CheckInvariants());
         void Freeze();
 
         /// \brief Gets a boolean flag that indicates whether incoming
         /// commands will be applied to the board or written to an
         /// output stream.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
         bool GetApplyCommands() const;
 
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
         std::ostream* GetErrorStream() const;
-        /// \pre require(value != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(value != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void SetErrorStream(std::ostream* value);
     private:
         /// \brief Checks if this type's invariants are being respected.
@@ -78,44 +78,44 @@ namespace Arcade
         // }
 
         /// \brief Prints a generic command.
-        /// \pre require(Command != nullptr);
+        /// \pre require_cheap(Command != nullptr);
         void Display(std::shared_ptr<ICommand<std::shared_ptr<Board>>> Command);
 
         /// \brief Prints a move command.
-        /// \pre require(Command != nullptr);
+        /// \pre require_cheap(Command != nullptr);
         void Display(std::shared_ptr<MoveCommand> Command);
 
         /// \brief Prints an attack command.
-        /// \pre require(Command != nullptr);
+        /// \pre require_cheap(Command != nullptr);
         void Display(std::shared_ptr<AttackCommand> Command);
 
         /// \brief Prints a piece's information.
-        /// \pre require(Piece != nullptr);
+        /// \pre require_cheap(Piece != nullptr);
         void Display(std::shared_ptr<PieceBase> Piece);
 
         /// \brief Prints a player piece's status.
-        /// \pre require(Piece != nullptr);
+        /// \pre require_cheap(Piece != nullptr);
         void Display(std::shared_ptr<Player> Piece);
 
         /// \brief Prints a monster piece's status.
-        /// \pre require(Piece != nullptr);
+        /// \pre require_cheap(Piece != nullptr);
         void Display(std::shared_ptr<Monster> Piece);
 
         /// \brief Prints a gate piece's status.
-        /// \pre require(Piece != nullptr);
+        /// \pre require_cheap(Piece != nullptr);
         void Display(std::shared_ptr<Gate> Piece);
 
         /// \brief Prints a button piece's status.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->GetIsInitialized());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->GetIsInitialized());
         void Display(std::shared_ptr<Button> Piece);
 
         /// \brief Prints a water piece's status.
-        /// \pre require(Piece != nullptr);
+        /// \pre require_cheap(Piece != nullptr);
         void Display(std::shared_ptr<Water> Piece);
 
         /// \brief Prints an obstacle piece's status.
-        /// \pre require(Piece != nullptr);
+        /// \pre require_cheap(Piece != nullptr);
         void Display(std::shared_ptr<Obstacle> Piece);
 
         /// \brief Prints an offset.
@@ -0,0 +1,146 @@
+#include "TranspositionTable.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include "Contracts.h"
+
+using namespace Arcade;
+
+const int TranspositionTable::MaxCapacity;
+
+/// \brief Creates an empty table that can hold the given number
+/// of hashes. The table allocates twice as many slots up front,
+/// rounded up to a power of two, so probe sequences stay short.
+/// \pre require_cheap(Capacity > 0 && Capacity <= MaxCapacity);
+/// \post ensure_cheap(this->CheckInvariants());
+TranspositionTable::TranspositionTable(int Capacity)
+    : capacity(Capacity), count(0)
+{
+    require_cheap(Capacity > 0 && Capacity <= MaxCapacity);
+    std::uint64_t slotCount = 1;
+    while (slotCount < 2 * (std::uint64_t)Capacity)
+        slotCount *= 2;
+
+    this->mask = slotCount - 1;
+    this->keys.reset(new std::atomic<std::uint64_t>[slotCount]);
+    for (std::uint64_t i = 0; i < slotCount; i++)
+        this->keys[i].store(0, std::memory_order_relaxed);
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Checks if this type's invariants are being respected.
+/// A boolean value is returned that indicates whether this is
+/// indeed the case. This method is publically visible, and can
+/// be used to verify an instance's state.
+bool TranspositionTable::CheckInvariants() const
+{
+    if (!this->isCheckingInvariants)
+    {
+        this->isCheckingInvariants = true;
+        bool result = this->capacity > 0 && this->keys != nullptr &&
+                      this->mask + 1 >= 2 * (std::uint64_t)this->capacity;
+        this->isCheckingInvariants = false;
+        return result;
+    }
+    return true;
+}
+
+/// \brief Inserts the given hash, unless the table already holds
+/// it. The index of the hash's slot is returned, and IsNew
+/// tells if this call has inserted it. If the hash is new and
+/// the table is full, -1 is returned instead.
+/// \remark This method may be called concurrently with itself
+/// and with Find. Concurrent inserts may take the count a little
+/// past the capacity, but a new hash is never refused while the
+/// table holds fewer hashes than its capacity.
+int TranspositionTable::Insert(std::uint64_t Hash, bool& IsNew)
+{
+    auto key = GetKey(Hash);
+    IsNew = false;
+    auto start = key & this->mask;
+    auto i = start;
+    do
+    {
+        auto current = this->keys[i].load(std::memory_order_acquire);
+        if (current == key)
+            return (int)i;
+
+        // Slots are never emptied, so the hash is not in the table.
+        if (current == 0)
+        {
+            if (this->count.load(std::memory_order_relaxed) >= this->capacity)
+            {
+                IsNew = true;
+                return -1;
+            }
+            if (this->keys[i].compare_exchange_strong(current, key, std::memory_order_acq_rel))
+            {
+                this->count.fetch_add(1, std::memory_order_relaxed);
+                IsNew = true;
+                return (int)i;
+            }
+
+            // Another thread has claimed the slot first, perhaps for the
+            // same hash.
+            if (current == key)
+                return (int)i;
+        }
+        i = (i + 1) & this->mask;
+    } while (i != start);
+
+    IsNew = true;
+    return -1;
+}
+
+/// \brief Gets the index of the given hash's slot, or -1 if the
+/// table does not hold the hash.
+/// \remark This method may be called concurrently with itself
+/// and with Insert.
+int TranspositionTable::Find(std::uint64_t Hash) const
+{
+    auto key = GetKey(Hash);
+    auto start = key & this->mask;
+    auto i = start;
+    do
+    {
+        auto current = this->keys[i].load(std::memory_order_acquire);
+        if (current == key)
+            return (int)i;
+        else if (current == 0)
+            return -1;
+        i = (i + 1) & this->mask;
+    } while (i != start);
+    return -1;
+}
+
+/// \brief Gets the number of hashes in the table.
+/// \pre require_cheap(this->CheckInvariants());
+int TranspositionTable::GetCount() const
+{
+    require_cheap(this->CheckInvariants());
+    return this->count.load(std::memory_order_relaxed);
+}
+
+/// \brief Gets the maximal number of hashes in the table.
+/// \pre require_cheap(this->CheckInvariants());
+int TranspositionTable::GetCapacity() const
+{
+    require_cheap(this->CheckInvariants());
+    return this->capacity;
+}
+
+/// \brief Gets the number of slots in the table. Slot indices lie
+/// in the range [0, GetSlotCount()).
+/// \pre require_cheap(this->CheckInvariants());
+int TranspositionTable::GetSlotCount() const
+{
+    require_cheap(this->CheckInvariants());
+    return (int)(this->mask + 1);
+}
+
+/// \brief Gets the value that the given hash is stored as.
+std::uint64_t TranspositionTable::GetKey(std::uint64_t Hash)
+{
+    return Hash == 0 ? 1 : Hash;
+}
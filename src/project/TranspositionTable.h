@@ -0,0 +1,79 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include "Contracts.h"
+
+namespace Arcade
+{
+    /// \brief Describes a fixed-size set of 64-bit state hashes that any
+    /// number of threads can insert into at the same time, without
+    /// taking locks. The set is an open-addressing hash table with
+    /// linear probing, whose slots are claimed with a compare-and-swap.
+    /// Every inserted hash keeps its slot for the table's lifetime, so
+    /// slot indices can be used to look up data that is stored next
+    /// to the table.
+    /// \remark Zero marks an empty slot. It is stored as one instead,
+    /// so hashes zero and one are treated as the same hash.
+    class TranspositionTable
+    {
+    public:
+        /// \brief The largest capacity that a table can have, so that
+        /// every slot index fits in an int.
+        static const int MaxCapacity = 1 << 29;
+
+        /// \brief Creates an empty table that can hold the given number
+        /// of hashes. The table allocates twice as many slots up front,
+        /// rounded up to a power of two, so probe sequences stay short.
+        /// \pre require_cheap(Capacity > 0 && Capacity <= MaxCapacity);
+        /// \post ensure_cheap(this->CheckInvariants());
+        explicit TranspositionTable(int Capacity);
+
+        TranspositionTable(const TranspositionTable& Other) = delete;
+        TranspositionTable& operator=(const TranspositionTable& Other) = delete;
+
+        /// \brief Checks if this type's invariants are being respected.
+        /// A boolean value is returned that indicates whether this is
+        /// indeed the case. This method is publically visible, and can
+        /// be used to verify an instance's state.
+        bool CheckInvariants() const;
+
+        /// \brief Inserts the given hash, unless the table already holds
+        /// it. The index of the hash's slot is returned, and IsNew
+        /// tells if this call has inserted it. If the hash is new and
+        /// the table is full, -1 is returned instead.
+        /// \remark This method may be called concurrently with itself
+        /// and with Find. Concurrent inserts may take the count a little
+        /// past the capacity, but a new hash is never refused while the
+        /// table holds fewer hashes than its capacity.
+        int Insert(std::uint64_t Hash, bool& IsNew);
+
+        /// \brief Gets the index of the given hash's slot, or -1 if the
+        /// table does not hold the hash.
+        /// \remark This method may be called concurrently with itself
+        /// and with Insert.
+        int Find(std::uint64_t Hash) const;
+
+        /// \brief Gets the number of hashes in the table.
+        /// \pre require_cheap(this->CheckInvariants());
+        int GetCount() const;
+
+        /// \brief Gets the maximal number of hashes in the table.
+        /// \pre require_cheap(this->CheckInvariants());
+        int GetCapacity() const;
+
+        /// \brief Gets the number of slots in the table. Slot indices lie
+        /// in the range [0, GetSlotCount()).
+        /// \pre require_cheap(this->CheckInvariants());
+        int GetSlotCount() const;
+    private:
+        /// \brief Gets the value that the given hash is stored as.
+        static std::uint64_t GetKey(std::uint64_t Hash);
+
+        mutable bool isCheckingInvariants = false;
+        int capacity;
+        std::uint64_t mask;
+        std::atomic<int> count;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> keys;
+    };
+}
@@ -1,5 +1,6 @@
 #include "Trap.h"
 
+#include <memory>
 #include "Board.h"
 #include "Collision.h"
 #include "Contracts.h"
@@ -17,14 +18,21 @@ Trap::Trap(Vector2<int> Position)
     this->SetMovable(false);
 }
 
+/// \brief Creates a copy of this piece that shares its
+/// identifier.
+std::shared_ptr<PieceBase> Trap::Clone() const
+{
+    return std::make_shared<Trap>(*this);
+}
+
 /// \brief Attacks this piece. A boolean is returned which indicates
 /// whether it has been destroyed or not.
-/// \pre require(Event.GetStaticPiece().get() == this);
+/// \pre require(Event.GetStaticPiece() == this);
 /// \post ensure(result);
 bool Trap::Attack(Collision Event)
 {
-    require(Event.GetStaticPiece().get() == this);
-    bool result = Event.GetScene()->RemovePiece(Event.GetStaticPiece());
+    require(Event.GetStaticPiece() == this);
+    bool result = Event.GetScene()->RemovePiece(Event.GetStaticHandle());
     ensure(result);
     return result;
 }
@@ -33,10 +41,10 @@ bool Trap::Attack(Collision Event)
 /// A boolean is returned that indicates whether another piece
 /// is free to move onto this piece's (previous) position or
 /// not.
-/// \pre require(Event.GetStaticPiece().get() == this);
+/// \pre require(Event.GetStaticPiece() == this);
 bool Trap::Collide(Collision Event)
 {
-    require(Event.GetStaticPiece().get() == this);
-    Event.GetScene()->RemovePiece(Event.GetStaticPiece());
-    return Event.GetScene()->RemovePiece(Event.GetMovingPiece());
+    require(Event.GetStaticPiece() == this);
+    Event.GetScene()->RemovePiece(Event.GetStaticHandle());
+    return Event.GetScene()->RemovePiece(Event.GetMovingHandle());
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include <memory>
 #include "Collision.h"
 #include "Obstacle.h"
 #include "Vector2.h"
@@ -11,9 +12,13 @@ namespace Arcade
         /// \brief Creates a new trap object.
         Trap(Vector2<int> Position);
 
+        /// \brief Creates a copy of this piece that shares its
+        /// identifier.
+        std::shared_ptr<PieceBase> Clone() const override;
+
         /// \brief Attacks this piece. A boolean is returned which indicates
         /// whether it has been destroyed or not.
-        /// \pre require(Event.GetStaticPiece().get() == this);
+        /// \pre require(Event.GetStaticPiece() == this);
         /// \post ensure(result);
         bool Attack(Collision Event) override;
 
@@ -21,7 +26,7 @@ namespace Arcade
         /// A boolean is returned that indicates whether another piece
         /// is free to move onto this piece's (previous) position or
         /// not.
-        /// \pre require(Event.GetStaticPiece().get() == this);
+        /// \pre require(Event.GetStaticPiece() == this);
         bool Collide(Collision Event) override;
     };
 }
\ No newline at end of file
@@ -15,27 +15,27 @@
 using namespace Arcade;
 
 /// \brief Creates a new UI handler from the given output stream.
-/// \pre require(outputStream != nullptr);
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(outputStream != nullptr);
+/// \post ensure_cheap(this->CheckInvariants());
 UIHandlerBase::UIHandlerBase(std::ostream* outputStream)
     : outputStream(outputStream)
 {
-    require(outputStream != nullptr);
-    ensure(this->CheckInvariants());
+    require_cheap(outputStream != nullptr);
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Applies a command to the board.
-/// \pre require(Command != nullptr);
-/// \pre require(this->GetIsInitialized());
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Command != nullptr);
+/// \pre require_cheap(this->GetIsInitialized());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void UIHandlerBase::Apply(std::shared_ptr<ICommand<std::shared_ptr<Board>>> Command)
 {
-    require(Command != nullptr);
-    require(this->GetIsInitialized());
-    require(this->CheckInvariants());
+    require_cheap(Command != nullptr);
+    require_cheap(this->GetIsInitialized());
+    require_cheap(this->CheckInvariants());
     Command->Execute(this->board);
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Checks if this type's invariants are being respected.
@@ -66,92 +66,105 @@ bool UIHandlerBase::CheckInvariantsCore() const
 
 /// \brief Initializes the UI handler and displays the board right
 /// away.
-/// \pre require(Value != nullptr);
-/// \pre require(!this->GetIsInitialized());
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->GetIsInitialized());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Value != nullptr);
+/// \pre require_cheap(!this->GetIsInitialized());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->GetIsInitialized());
+/// \post ensure_cheap(this->CheckInvariants());
 void UIHandlerBase::Initialize(std::shared_ptr<Board> Value)
 {
-    require(Value != nullptr);
-    require(!this->GetIsInitialized());
-    require(this->CheckInvariants());
+    require_cheap(Value != nullptr);
+    require_cheap(!this->GetIsInitialized());
+    require_cheap(this->CheckInvariants());
     this->board = Value;
     this->Display();
-    ensure(this->GetIsInitialized());
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->GetIsInitialized());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Gets a boolean value that indicates if the board contains
 /// any player at this time.
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
 bool UIHandlerBase::GetContainsPlayers() const
 {
-    require(this->CheckInvariants());
-    auto players = this->board->GetPlayers();
-    return !players.empty();
+    require_cheap(this->CheckInvariants());
+    return !this->board->GetPlayers().empty();
 }
 
 /// \brief Examines the board and figures out whether the game has
 /// ended or not.
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
 bool UIHandlerBase::GetHasEnded() const
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     return !this->GetContainsPlayers() || this->GetPlayerHasWon();
 }
 
 /// \brief Gets a boolean flag that indicates if the UI handler has
 /// been initialized.
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
 bool UIHandlerBase::GetIsInitialized() const
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     return this->board != nullptr;
 }
 
 /// \brief Gets the UI handler's output stream.
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
 std::ostream* UIHandlerBase::GetOutputStream() const
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     return this->outputStream;
 }
 
 /// \brief Sets the UI handler's output stream.
-/// \pre require(value != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(value != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void UIHandlerBase::SetOutputStream(std::ostream* value)
 {
-    require(value != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(value != nullptr);
+    require_cheap(this->CheckInvariants());
     this->outputStream = value;
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Determines whether a player has won, i.e.
 /// whether a player is currently standing on a goal.
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
 bool UIHandlerBase::GetPlayerHasWon() const
 {
-    require(this->CheckInvariants());
-    for (auto& item : this->board->GetPieces())
-        if (stdx::isinstance<Goal>(item))
-        {
-            auto goal = std::dynamic_pointer_cast<Goal>(item);
-            for (auto& player : this->board->GetPlayers())
-                if (goal->IsPlayerVictorious(this->board, player))
-                    return true;
-
-        }
+    require_cheap(this->CheckInvariants());
+    for (auto& goal : this->board->GetGoals())
+        for (auto& player : this->board->GetPlayers())
+            if (goal->IsPlayerVictorious(this->board, player))
+                return true;
+
     return false;
 }
 
 /// \brief Gets the UI handler's board.
-/// \pre require(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
 std::shared_ptr<Board> UIHandlerBase::GetScene() const
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     return this->board;
+}
+
+/// \brief Replaces the UI handler's board, e.g. to jump to
+/// another step of a replay. Unlike Initialize, this does not
+/// display the board.
+/// \pre require_cheap(Value != nullptr);
+/// \pre require_cheap(this->GetIsInitialized());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->GetScene() == Value);
+/// \post ensure_cheap(this->CheckInvariants());
+void UIHandlerBase::SetScene(std::shared_ptr<Board> Value)
+{
+    require_cheap(Value != nullptr);
+    require_cheap(this->GetIsInitialized());
+    require_cheap(this->CheckInvariants());
+    this->board = Value;
+    ensure_cheap(this->GetScene() == Value);
+    ensure_cheap(this->CheckInvariants());
 }
\ No newline at end of file
@@ -19,15 +19,15 @@ namespace Arcade
     {
     public:
         /// \brief Creates a new UI handler from the given output stream.
-        /// \pre require(outputStream != nullptr);
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(outputStream != nullptr);
+        /// \post ensure_cheap(this->CheckInvariants());
         UIHandlerBase(std::ostream* outputStream);
 
         /// \brief Applies a command to the board.
-        /// \pre require(Command != nullptr);
-        /// \pre require(this->GetIsInitialized());
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Command != nullptr);
+        /// \pre require_cheap(this->GetIsInitialized());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void Apply(std::shared_ptr<ICommand<std::shared_ptr<Board>>> Command) override;
 
         /// \brief Checks if this type's invariants are being respected.
@@ -37,51 +37,61 @@ namespace Arcade
         bool CheckInvariants() const;
 
         /// \brief Displays the board.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         virtual void Display() override = 0;
 
         /// \brief Initializes the UI handler and displays the board right
         /// away.
-        /// \pre require(Value != nullptr);
-        /// \pre require(!this->GetIsInitialized());
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->GetIsInitialized());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Value != nullptr);
+        /// \pre require_cheap(!this->GetIsInitialized());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->GetIsInitialized());
+        /// \post ensure_cheap(this->CheckInvariants());
         void Initialize(std::shared_ptr<Board> Value) override;
 
         /// \brief Gets a boolean value that indicates if the board contains
         /// any player at this time.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
         bool GetContainsPlayers() const;
 
         /// \brief Examines the board and figures out whether the game has
         /// ended or not.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
         bool GetHasEnded() const;
 
         /// \brief Gets a boolean flag that indicates if the UI handler has
         /// been initialized.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
         bool GetIsInitialized() const override;
 
         /// \brief Gets the UI handler's output stream.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
         std::ostream* GetOutputStream() const;
         /// \brief Sets the UI handler's output stream.
-        /// \pre require(value != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(value != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void SetOutputStream(std::ostream* value);
 
         /// \brief Determines whether a player has won, i.e.
         /// whether a player is currently standing on a goal.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
         bool GetPlayerHasWon() const;
 
         /// \brief Gets the UI handler's board.
-        /// \pre require(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
         std::shared_ptr<Board> GetScene() const;
+
+        /// \brief Replaces the UI handler's board, e.g. to jump to
+        /// another step of a replay. Unlike Initialize, this does not
+        /// display the board.
+        /// \pre require_cheap(Value != nullptr);
+        /// \pre require_cheap(this->GetIsInitialized());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->GetScene() == Value);
+        /// \post ensure_cheap(this->CheckInvariants());
+        void SetScene(std::shared_ptr<Board> Value);
     protected:
         /// \brief Checks if this type's invariants are being respected.
         /// A boolean value is returned that indicates whether this is
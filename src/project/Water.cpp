@@ -19,17 +19,24 @@ Water::Water(Vector2<int> Position, bool Movable)
     this->SetObstacleType("water");
 }
 
+/// \brief Creates a copy of this piece that shares its
+/// identifier.
+std::shared_ptr<PieceBase> Water::Clone() const
+{
+    return std::make_shared<Water>(*this);
+}
+
 /// \brief Has a piece collide with this piece.
 /// A boolean is returned that indicates whether this piece
 /// has moved or not.
-/// \pre require(Event.GetStaticPiece().get() == this);
+/// \pre require(Event.GetStaticPiece() == this);
 bool Water::Collide(Collision Event)
 {
-    require(Event.GetStaticPiece().get() == this);
-    auto mp = Event.GetMovingPiece();
-    auto sp = Event.GetStaticPiece();
+    require(Event.GetStaticPiece() == this);
+    auto mp = Event.GetMovingHandle();
+    auto sp = Event.GetStaticHandle();
     auto scene = Event.GetScene();
-    if (stdx::isinstance<Obstacle>(mp))
+    if (stdx::isinstance<Obstacle>(*Event.GetMovingPiece()))
     {
         scene->RemovePiece(mp);
         scene->RemovePiece(sp);
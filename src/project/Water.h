@@ -1,4 +1,5 @@
 #pragma once
+#include <memory>
 #include "Collision.h"
 #include "Obstacle.h"
 #include "Vector2.h"
@@ -11,10 +12,14 @@ namespace Arcade
         /// \brief Creates a new water object.
         Water(Vector2<int> Position, bool Movable);
 
+        /// \brief Creates a copy of this piece that shares its
+        /// identifier.
+        std::shared_ptr<PieceBase> Clone() const override;
+
         /// \brief Has a piece collide with this piece.
         /// A boolean is returned that indicates whether this piece
         /// has moved or not.
-        /// \pre require(Event.GetStaticPiece().get() == this);
+        /// \pre require(Event.GetStaticPiece() == this);
         bool Collide(Collision Event) override;
     };
 }
\ No newline at end of file
@@ -0,0 +1,204 @@
+#include "WorkStealingPool.h"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Contracts.h"
+
+using namespace Arcade;
+
+/// \brief Creates a pool that runs tasks on the given number of
+/// threads. The thread that calls Run is one of them.
+/// \pre require_cheap(ThreadCount > 0);
+/// \post ensure_cheap(this->CheckInvariants());
+WorkStealingPool::WorkStealingPool(int ThreadCount)
+    : threadCount(ThreadCount)
+{
+    require_cheap(ThreadCount > 0);
+    for (int i = 0; i < ThreadCount; i++)
+        this->queues.emplace_back(new WorkQueue());
+    for (int i = 1; i < ThreadCount; i++)
+        this->threads.emplace_back([this, i] { this->RunThread(i); });
+    ensure_cheap(this->CheckInvariants());
+}
+
+/// \brief Stops the pool's threads, and waits for them to exit.
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(this->batchLock);
+        this->isStopping = true;
+    }
+    this->batchStarted.notify_all();
+    for (auto& thread : this->threads)
+        thread.join();
+}
+
+/// \brief Checks if this type's invariants are being respected.
+/// A boolean value is returned that indicates whether this is
+/// indeed the case. This method is publically visible, and can
+/// be used to verify an instance's state.
+bool WorkStealingPool::CheckInvariants() const
+{
+    if (!this->isCheckingInvariants)
+    {
+        this->isCheckingInvariants = true;
+        bool result = this->threadCount > 0 && (int)this->queues.size() == this->threadCount &&
+                      (int)this->threads.size() == this->threadCount - 1;
+        this->isCheckingInvariants = false;
+        return result;
+    }
+    return true;
+}
+
+/// \brief Gets the number of threads that this pool runs tasks on.
+/// \pre require_cheap(this->CheckInvariants());
+int WorkStealingPool::GetThreadCount() const
+{
+    require_cheap(this->CheckInvariants());
+    return this->threadCount;
+}
+
+/// \brief Runs the given task once for every index in the range
+/// [0, TaskCount), and returns once every task has completed.
+/// If a task throws an exception, the remaining tasks are
+/// still run, after which the first exception is rethrown.
+/// \pre require_cheap(TaskCount >= 0);
+/// \pre require_cheap(this->CheckInvariants());
+void WorkStealingPool::Run(int TaskCount, const std::function<void(int)>& Task)
+{
+    require_cheap(TaskCount >= 0);
+    require_cheap(this->CheckInvariants());
+    // Hand every thread a contiguous range of the tasks. Neighbouring
+    // tasks tend to take similar amounts of time, so threads only
+    // need to steal once their own range runs dry.
+    for (int i = 0; i < this->threadCount; i++)
+    {
+        auto& queue = *this->queues[i];
+        std::lock_guard<std::mutex> guard(queue.Lock);
+        queue.Begin = (int)((long long)TaskCount * i / this->threadCount);
+        queue.End = (int)((long long)TaskCount * (i + 1) / this->threadCount);
+    }
+
+    std::mutex errorLock;
+    std::exception_ptr error;
+    std::function<void(int)> runTask = [&](int Index)
+    {
+        try
+        {
+            Task(Index);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> guard(errorLock);
+            if (error == nullptr)
+                error = std::current_exception();
+        }
+    };
+
+    {
+        std::lock_guard<std::mutex> guard(this->batchLock);
+        this->batchTask = &runTask;
+        this->busyThreads = this->threadCount - 1;
+        this->batchNumber++;
+    }
+    this->batchStarted.notify_all();
+    this->RunWorker(0, runTask);
+    {
+        std::unique_lock<std::mutex> guard(this->batchLock);
+        this->batchFinished.wait(guard, [this] { return this->busyThreads == 0; });
+        this->batchTask = nullptr;
+    }
+
+    if (error != nullptr)
+        std::rethrow_exception(error);
+}
+
+/// \brief Gets the number of threads that the hardware can run
+/// concurrently, or one if that number is unknown.
+int WorkStealingPool::GetDefaultThreadCount()
+{
+    int result = (int)std::thread::hardware_concurrency();
+    return result > 0 ? result : 1;
+}
+
+/// \brief Waits for batches, and runs their tasks on the given
+/// thread, until the pool is stopped.
+void WorkStealingPool::RunThread(int Worker)
+{
+    long long finishedBatch = 0;
+    while (true)
+    {
+        const std::function<void(int)>* task;
+        {
+            std::unique_lock<std::mutex> guard(this->batchLock);
+            this->batchStarted.wait(guard, [&] { return this->isStopping || this->batchNumber != finishedBatch; });
+            if (this->isStopping)
+                return;
+            finishedBatch = this->batchNumber;
+            task = this->batchTask;
+        }
+
+        this->RunWorker(Worker, *task);
+
+        std::lock_guard<std::mutex> guard(this->batchLock);
+        if (--this->busyThreads == 0)
+            this->batchFinished.notify_one();
+    }
+}
+
+/// \brief Runs tasks from the given thread's queue, and then
+/// from the other queues, until no tasks are left.
+void WorkStealingPool::RunWorker(int Worker, const std::function<void(int)>& Task)
+{
+    int index;
+    while (this->TakeTask(Worker, index))
+        Task(index);
+}
+
+/// \brief Takes a task from the given thread's own queue, or
+/// steals one from another queue. A boolean is returned that
+/// tells if a task has been found.
+bool WorkStealingPool::TakeTask(int Worker, int& Result)
+{
+    auto& own = *this->queues[Worker];
+    {
+        std::lock_guard<std::mutex> guard(own.Lock);
+        if (own.Begin < own.End)
+        {
+            Result = own.Begin++;
+            return true;
+        }
+    }
+
+    // Tasks are never added while the pool is running, so a thread
+    // that finds every queue empty is done. Stealing half of a range
+    // at once keeps the number of steals logarithmic in its size.
+    for (int i = 1; i < this->threadCount; i++)
+    {
+        auto& victim = *this->queues[(Worker + i) % this->threadCount];
+        int begin, end;
+        {
+            std::lock_guard<std::mutex> guard(victim.Lock);
+            if (victim.Begin >= victim.End)
+                continue;
+
+            end = victim.End;
+            begin = victim.End - (victim.End - victim.Begin + 1) / 2;
+            victim.End = begin;
+        }
+
+        // Only this thread adds to its own range, and the range is
+        // empty, so other threads cannot have changed it meanwhile.
+        std::lock_guard<std::mutex> guard(own.Lock);
+        Result = begin;
+        own.Begin = begin + 1;
+        own.End = end;
+        return true;
+    }
+    return false;
+}
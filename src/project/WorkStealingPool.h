@@ -0,0 +1,97 @@
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Contracts.h"
+
+namespace Arcade
+{
+    /// \brief Runs batches of independent tasks on a fixed number of
+    /// threads. The threads are started once, and wait for the next
+    /// batch in between batches. Every thread starts out with its own
+    /// contiguous range of the tasks, and takes tasks from the front
+    /// of that range. A thread that runs out of work steals the back
+    /// half of another thread's range, so a few slow tasks do not hold
+    /// up the threads that happen to share a range with them. A pool
+    /// runs one batch at a time.
+    class WorkStealingPool
+    {
+    public:
+        /// \brief Creates a pool that runs tasks on the given number of
+        /// threads. The thread that calls Run is one of them.
+        /// \pre require_cheap(ThreadCount > 0);
+        /// \post ensure_cheap(this->CheckInvariants());
+        explicit WorkStealingPool(int ThreadCount);
+
+        /// \brief Stops the pool's threads, and waits for them to exit.
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool& Other) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool& Other) = delete;
+
+        /// \brief Checks if this type's invariants are being respected.
+        /// A boolean value is returned that indicates whether this is
+        /// indeed the case. This method is publically visible, and can
+        /// be used to verify an instance's state.
+        bool CheckInvariants() const;
+
+        /// \brief Gets the number of threads that this pool runs tasks on.
+        /// \pre require_cheap(this->CheckInvariants());
+        int GetThreadCount() const;
+
+        /// \brief Runs the given task once for every index in the range
+        /// [0, TaskCount), and returns once every task has completed.
+        /// If a task throws an exception, the remaining tasks are
+        /// still run, after which the first exception is rethrown.
+        /// \pre require_cheap(TaskCount >= 0);
+        /// \pre require_cheap(this->CheckInvariants());
+        void Run(int TaskCount, const std::function<void(int)>& Task);
+
+        /// \brief Gets the number of threads that the hardware can run
+        /// concurrently, or one if that number is unknown.
+        static int GetDefaultThreadCount();
+    private:
+        /// \brief Describes the range [Begin, End) of task indices that a
+        /// thread has yet to run.
+        struct WorkQueue
+        {
+            std::mutex Lock;
+            int Begin = 0;
+            int End = 0;
+        };
+
+        /// \brief Waits for batches, and runs their tasks on the given
+        /// thread, until the pool is stopped.
+        void RunThread(int Worker);
+
+        /// \brief Runs tasks from the given thread's queue, and then
+        /// from the other queues, until no tasks are left.
+        void RunWorker(int Worker, const std::function<void(int)>& Task);
+
+        /// \brief Takes a task from the given thread's own queue, or
+        /// steals one from another queue. A boolean is returned that
+        /// tells if a task has been found.
+        bool TakeTask(int Worker, int& Result);
+
+        mutable bool isCheckingInvariants = false;
+        int threadCount;
+        std::vector<std::unique_ptr<WorkQueue>> queues;
+        std::vector<std::thread> threads;
+        /// \brief Guards the fields below, which describe the batch that
+        /// is being run.
+        std::mutex batchLock;
+        std::condition_variable batchStarted;
+        std::condition_variable batchFinished;
+        const std::function<void(int)>* batchTask = nullptr;
+        /// \brief Counts the batches that have been started, so that
+        /// threads can tell a new batch from one they have finished.
+        long long batchNumber = 0;
+        /// \brief The number of threads, besides the calling thread, that
+        /// have yet to finish the current batch.
+        int busyThreads = 0;
+        bool isStopping = false;
+    };
+}
@@ -24,96 +24,96 @@ using namespace Arcade;
 
 /// \brief Creates a new XML UI handler that writes to the given
 /// output stream.
-/// \pre require(outputStream != nullptr);
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(outputStream != nullptr);
+/// \post ensure_cheap(this->CheckInvariants());
 XmlUIHandler::XmlUIHandler(std::ostream* outputStream)
     : UnorderedPieceUIHandlerBase(outputStream)
 {
-    require(outputStream != nullptr);
-    ensure(this->CheckInvariants());
+    require_cheap(outputStream != nullptr);
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given barrel piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void XmlUIHandler::DisplayBarrel(std::shared_ptr<Obstacle> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplayObstacle(Piece, Piece->GetObstacleType());
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a button piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void XmlUIHandler::DisplayButton(std::shared_ptr<Button> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     std::string gateId = Piece->GetAssociatedGateName(this->board);
     *this->outputStream << "<KNOP id=\"" << gateId << "\" " << 
                            this->showPosition(Piece->GetPosition()) << "/>\n";
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays an unknown piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void XmlUIHandler::DisplayDefault(std::shared_ptr<PieceBase> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplayObstacle(Piece, "ONBEKEND");
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a footer.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void XmlUIHandler::DisplayFooter()
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     *this->outputStream << "</VELD>" << "\n";
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a goal piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void XmlUIHandler::DisplayGate(std::shared_ptr<Gate> Piece, bool IsOpened)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     *this->outputStream << "<POORT " << this->showMovable(Piece->GetMovable()) << " " << this->showPosition(Piece->GetPosition()) << ">\n";
     *this->outputStream << 
         this->showStringElement("ID", Piece->GetName()) << "\n";
     *this->outputStream << "</POORT>\n";
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a goal piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void XmlUIHandler::DisplayGoal(std::shared_ptr<Goal> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplaySimpleObstacle(Piece, "DOEL");
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a header.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void XmlUIHandler::DisplayHeader()
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     *this->outputStream << 
         "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n";
     *this->outputStream << "<VELD>\n";
@@ -124,43 +124,43 @@ void XmlUIHandler::DisplayHeader()
         "<BREEDTE>" << this->board->GetWidth() << "</BREEDTE>\n";
     *this->outputStream << 
         "<LENGTE>" << this->board->GetHeight() << "</LENGTE>\n";
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given monster piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void XmlUIHandler::DisplayMonster(std::shared_ptr<Monster> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     *this->outputStream << 
         "<MONSTER " << this->showPosition(Piece->GetPosition()) << 
         ">\n";
     *this->outputStream << 
         this->showStringElement("ID", Piece->GetName()) << "\n";
     *this->outputStream << "</MONSTER>\n";
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given obstacle piece.
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void XmlUIHandler::DisplayObstacle(std::shared_ptr<Obstacle> Piece)
 {
-    require(this->CheckInvariants());
+    require_cheap(this->CheckInvariants());
     this->DisplayObstacle(Piece, Piece->GetObstacleType());
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays an obstacle, which consists of a name tag, a
 /// boolean that states whether the piece is movable or not,
 /// and a position.
-/// \pre require(Piece != nullptr);
+/// \pre require_cheap(Piece != nullptr);
 void XmlUIHandler::DisplayObstacle(std::shared_ptr<PieceBase> Piece, std::string Name)
 {
-    require(Piece != nullptr);
+    require_cheap(Piece != nullptr);
     *this->outputStream << "<";
     this->WriteUpperName(Name);
     *this->outputStream << 
@@ -169,28 +169,28 @@ void XmlUIHandler::DisplayObstacle(std::shared_ptr<PieceBase> Piece, std::string
 }
 
 /// \brief Displays the given player piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void XmlUIHandler::DisplayPlayer(std::shared_ptr<Player> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     *this->outputStream << 
         "<SPELER " << this->showPosition(Piece->GetPosition()) << 
         ">\n";
     *this->outputStream << 
         this->showStringElement("NAAM", Piece->GetName()) << "\n";
     *this->outputStream << "</SPELER>\n";
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a simple obstacle, which consists of a name tag
 /// and a position.
-/// \pre require(Piece != nullptr);
+/// \pre require_cheap(Piece != nullptr);
 void XmlUIHandler::DisplaySimpleObstacle(std::shared_ptr<PieceBase> Piece, std::string Name)
 {
-    require(Piece != nullptr);
+    require_cheap(Piece != nullptr);
     *this->outputStream << "<";
     this->WriteUpperName(Name);
     *this->outputStream << 
@@ -198,39 +198,39 @@ void XmlUIHandler::DisplaySimpleObstacle(std::shared_ptr<PieceBase> Piece, std::
 }
 
 /// \brief Displays a trap piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void XmlUIHandler::DisplayTrap(std::shared_ptr<Trap> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplaySimpleObstacle(Piece, "VALSTRIK");
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays the given wall piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void XmlUIHandler::DisplayWall(std::shared_ptr<Obstacle> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplayObstacle(Piece, Piece->GetObstacleType());
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Displays a water piece.
-/// \pre require(Piece != nullptr);
-/// \pre require(this->CheckInvariants());
-/// \post ensure(this->CheckInvariants());
+/// \pre require_cheap(Piece != nullptr);
+/// \pre require_cheap(this->CheckInvariants());
+/// \post ensure_cheap(this->CheckInvariants());
 void XmlUIHandler::DisplayWater(std::shared_ptr<Water> Piece)
 {
-    require(Piece != nullptr);
-    require(this->CheckInvariants());
+    require_cheap(Piece != nullptr);
+    require_cheap(this->CheckInvariants());
     this->DisplayObstacle(Piece, Piece->GetObstacleType());
-    ensure(this->CheckInvariants());
+    ensure_cheap(this->CheckInvariants());
 }
 
 /// \brief Gets a string representation of the movable attribute set
@@ -24,94 +24,94 @@ namespace Arcade
     public:
         /// \brief Creates a new XML UI handler that writes to the given
         /// output stream.
-        /// \pre require(outputStream != nullptr);
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(outputStream != nullptr);
+        /// \post ensure_cheap(this->CheckInvariants());
         XmlUIHandler(std::ostream* outputStream);
     protected:
         /// \brief Displays the given barrel piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void DisplayBarrel(std::shared_ptr<Obstacle> Piece) override;
 
         /// \brief Displays a button piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void DisplayButton(std::shared_ptr<Button> Piece) override;
 
         /// \brief Displays an unknown piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void DisplayDefault(std::shared_ptr<PieceBase> Piece) override;
 
         /// \brief Displays a footer.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void DisplayFooter() override;
 
         /// \brief Displays a goal piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void DisplayGate(std::shared_ptr<Gate> Piece, bool IsOpened) override;
 
         /// \brief Displays a goal piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void DisplayGoal(std::shared_ptr<Goal> Piece) override;
 
         /// \brief Displays a header.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void DisplayHeader() override;
 
         /// \brief Displays the given monster piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void DisplayMonster(std::shared_ptr<Monster> Piece) override;
 
         /// \brief Displays the given obstacle piece.
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void DisplayObstacle(std::shared_ptr<Obstacle> Piece) override;
 
         /// \brief Displays the given player piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void DisplayPlayer(std::shared_ptr<Player> Piece) override;
 
         /// \brief Displays a trap piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void DisplayTrap(std::shared_ptr<Trap> Piece) override;
 
         /// \brief Displays the given wall piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void DisplayWall(std::shared_ptr<Obstacle> Piece) override;
 
         /// \brief Displays a water piece.
-        /// \pre require(Piece != nullptr);
-        /// \pre require(this->CheckInvariants());
-        /// \post ensure(this->CheckInvariants());
+        /// \pre require_cheap(Piece != nullptr);
+        /// \pre require_cheap(this->CheckInvariants());
+        /// \post ensure_cheap(this->CheckInvariants());
         void DisplayWater(std::shared_ptr<Water> Piece) override;
     private:
         /// \brief Displays an obstacle, which consists of a name tag, a
         /// boolean that states whether the piece is movable or not,
         /// and a position.
-        /// \pre require(Piece != nullptr);
+        /// \pre require_cheap(Piece != nullptr);
         void DisplayObstacle(std::shared_ptr<PieceBase> Piece, std::string Name);
 
         /// \brief Displays a simple obstacle, which consists of a name tag
         /// and a position.
-        /// \pre require(Piece != nullptr);
+        /// \pre require_cheap(Piece != nullptr);
         void DisplaySimpleObstacle(std::shared_ptr<PieceBase> Piece, std::string Name);
 
         /// \brief Gets a string representation of the movable attribute set